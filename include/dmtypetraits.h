@@ -42,7 +42,18 @@
     * `dmtypetraits_md5.h`: 提供 MD5 哈希计算功能，主要用于序列化模块中的类型校验。
     * `dmtypetraits_reflection.h`: 提供无侵入式的编译期反射功能。
     * `dmtypetraits_reflection_intrusive.h`: 提供侵入式的编译期反射功能。
+    * `dmtypetraits_split.h`: 冷热分离的聚合体容器 dm::split，热成员紧凑存放，冷成员放在旁表。
+    * `dmtypetraits_hash.h`: 基于反射的哈希 dm::hash，按成员递归，无填充的类型整体一次哈希。
+    * `dmtypetraits_compare.h`: 基于反射的相等与字典序比较 dm::equal/dm::compare，无填充的类型走 memcmp。
+    * `dmtypetraits_layout.h`: 聚合体成员的编译期偏移量与大小，以及填充分析 (填充字节数、建议的成员顺序)。
+    * `dmtypetraits_soa.h`: 按成员分列存放聚合体的容器 dm::soa_vector，单个成员的扫描是连续内存访问。
+    * `dmtypetraits_reflection_runtime.h`: 类型擦除的运行期字段表 (名字、偏移、类型大类、读写与序列化函数)，用于动态访问。
     * `dmtypetraits_pack.h`: 提供高性能的二进制序列化和反序列化功能。     
+    * `dmtypetraits_pack_codec.h`: 提供序列化模块使用的压缩编码 (如整数序列的 delta + 位压缩)。
+    * `dmtypetraits_pack_migrate.h`: 按旧版本的类型描述串把旧数据解码为当前类型 (字段加宽、增删、重排)。
+    * `dmtypetraits_pack_cursor.h`: 可分段执行的序列化器，每次只输出有限的字节数，用于把大对象的序列化分摊到多次调用。
+    * `dmtypetraits_pack_channel.h`: 单生产者/单消费者的无锁消息通道，消息直接在环形缓冲区上序列化与反序列化。
+    * `dmtypetraits_pack_snapshot.h`: 基于 fork 的后台快照，子进程在写时复制的内存视图上把对象流式写入文件 (仅 POSIX)。
 */
 
 #include "dmtypetraits_base.h"
@@ -54,5 +65,15 @@
 #include "dmtypetraits_md5.h"
 #include "dmtypetraits_reflection.h"
 #include "dmtypetraits_reflection_intrusive.h"
+#include "dmtypetraits_soa.h"
+#include "dmtypetraits_split.h"
+#include "dmtypetraits_hash.h"
+#include "dmtypetraits_compare.h"
+#include "dmtypetraits_layout.h"
 #include "dmtypetraits_pack.h"
+#include "dmtypetraits_pack_migrate.h"
+#include "dmtypetraits_pack_cursor.h"
+#include "dmtypetraits_pack_channel.h"
+#include "dmtypetraits_pack_snapshot.h"
+#include "dmtypetraits_reflection_runtime.h"
 #endif // __DMTYPETRAITS_H_INCLUDE__
\ No newline at end of file
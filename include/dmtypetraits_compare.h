@@ -0,0 +1,223 @@
+#ifndef __DMTYPETRAITS_COMPARE_H_INCLUDE__
+#define __DMTYPETRAITS_COMPARE_H_INCLUDE__
+
+#include "dmtypetraits_reflection.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace dm {
+
+    namespace detail {
+
+        // 无序容器的遍历顺序与内容无关，只能交给它自己的 ==
+        template <typename T, typename = void>
+        struct is_unordered_compare : std::false_type {};
+
+        template <typename T>
+        struct is_unordered_compare<T, std::void_t<typename T::hasher, typename T::key_equal>> : std::true_type {};
+
+        // 元素没有填充且相等即逐字节相等的连续容器
+        template <typename T>
+        constexpr bool compare_contiguous_bytes() {
+            if constexpr (dm::pack::detail::dm_pack_is_std_vector_v<T> || dm::pack::detail::dm_pack_is_std_basic_string_v<T> ||
+                dm_is_std_array_v<T>) {
+                using value_type = typename T::value_type;
+                return !dm_is_same_v<value_type, bool> && std::has_unique_object_representations_v<value_type>;
+            }
+            else { return false; }
+        }
+
+        // memcmp 的字节序只对单字节无符号元素与逐值比较的结果一致
+        template <typename T>
+        constexpr bool memcmp_orders() {
+            return dm_is_same_v<T, unsigned char> || dm_is_same_v<T, std::byte> ||
+                (dm_is_same_v<T, char> && !std::is_signed_v<char>);
+        }
+
+        template <typename T>
+        constexpr bool memcmp_orders_container() {
+            if constexpr (compare_contiguous_bytes<T>()) { return memcmp_orders<typename T::value_type>(); }
+            else { return false; }
+        }
+
+        template <typename T>
+        constexpr bool compare_as_aggregate() {
+            return dm_is_class_v<T> && dm_is_aggregate_v<T> && !dm_is_container_v<T> && !dm_is_tuple_like_v<T>;
+        }
+
+        template <typename T>
+        bool equal_impl(const T& a, const T& b);
+
+        template <typename T>
+        int compare_impl(const T& a, const T& b);
+
+        template <typename TA, typename TB, std::size_t... I>
+        bool equal_tuple(const TA& a, const TB& b, std::index_sequence<I...>) {
+            return (equal_impl(std::get<I>(a), std::get<I>(b)) && ...);
+        }
+
+        template <typename TA, typename TB, std::size_t... I>
+        int compare_tuple(const TA& a, const TB& b, std::index_sequence<I...>) {
+            int r = 0;
+            // 逗号折叠配合 || 在第一个不等的成员处停止
+            (void)((r = compare_impl(std::get<I>(a), std::get<I>(b)), r != 0) || ...);
+            return r;
+        }
+
+        template <typename V, std::size_t... I>
+        bool equal_variant(const V& a, const V& b, std::index_sequence<I...>) {
+            bool r = true;
+            (void)((a.index() == I && (r = equal_impl(std::get<I>(a), std::get<I>(b)), true)) || ...);
+            return r;
+        }
+
+        template <typename V, std::size_t... I>
+        int compare_variant(const V& a, const V& b, std::index_sequence<I...>) {
+            int r = 0;
+            (void)((a.index() == I && (r = compare_impl(std::get<I>(a), std::get<I>(b)), true)) || ...);
+            return r;
+        }
+
+        template <typename T>
+        bool equal_impl(const T& a, const T& b) {
+            if constexpr (std::has_unique_object_representations_v<T>) {
+                return std::memcmp(&a, &b, sizeof(T)) == 0;
+            }
+            else if constexpr (std::is_floating_point_v<T>) {
+                return a == b;
+            }
+            else if constexpr (dm_is_string_like_v<T>) {
+                return std::string_view(a) == std::string_view(b);
+            }
+            else if constexpr (compare_contiguous_bytes<T>()) {
+                return a.size() == b.size() &&
+                    (a.size() == 0 || std::memcmp(a.data(), b.data(), a.size() * sizeof(typename T::value_type)) == 0);
+            }
+            else if constexpr (dm_is_optional_v<T>) {
+                if (a.has_value() != b.has_value()) { return false; }
+                return !a.has_value() || equal_impl(*a, *b);
+            }
+            else if constexpr (dm_is_variant_v<T>) {
+                if (a.index() != b.index()) { return false; }
+                return equal_variant(a, b, std::make_index_sequence<std::variant_size_v<T>>());
+            }
+            else if constexpr (dm_is_tuple_like_v<T>) {
+                return equal_tuple(a, b, std::make_index_sequence<std::tuple_size_v<T>>());
+            }
+            else if constexpr (is_unordered_compare<T>::value) {
+                return a == b;
+            }
+            else if constexpr (dm_is_container_v<T> || dm_is_c_array_v<T>) {
+                if (std::size(a) != std::size(b)) { return false; }
+                auto ib = std::begin(b);
+                for (const auto& x : a) {
+                    if (!equal_impl(x, *ib)) { return false; }
+                    ++ib;
+                }
+                return true;
+            }
+            else if constexpr (compare_as_aggregate<T>()) {
+                auto ta = dm_struct_to_tuple(a);
+                auto tb = dm_struct_to_tuple(b);
+                return equal_tuple(ta, tb, std::make_index_sequence<std::tuple_size_v<decltype(ta)>>());
+            }
+            else {
+                return a == b;
+            }
+        }
+
+        template <typename T>
+        int compare_impl(const T& a, const T& b) {
+            if constexpr (memcmp_orders<T>() || std::is_arithmetic_v<T> || dm_is_enum_v<T> || std::is_pointer_v<T>) {
+                return a < b ? -1 : (b < a ? 1 : 0);
+            }
+            else if constexpr (dm_is_c_array_v<T>) {
+                // 定长数组按全部 N 个元素比较，不能当作以 NUL 结尾的字符串 (与 equal 的逐字节比较一致)
+                using element = std::remove_extent_t<T>;
+                if constexpr (memcmp_orders<element>()) {
+                    int r = std::memcmp(a, b, sizeof(T));
+                    return r < 0 ? -1 : (r > 0 ? 1 : 0);
+                }
+                else {
+                    for (std::size_t i = 0; i < std::extent_v<T>; ++i) {
+                        int r = compare_impl(a[i], b[i]);
+                        if (r != 0) { return r; }
+                    }
+                    return 0;
+                }
+            }
+            else if constexpr (dm_is_string_like_v<T>) {
+                int r = std::string_view(a).compare(std::string_view(b));
+                return r < 0 ? -1 : (r > 0 ? 1 : 0);
+            }
+            else if constexpr (memcmp_orders_container<T>()) {
+                std::size_t n = (std::min)(a.size(), b.size());
+                int r = n == 0 ? 0 : std::memcmp(a.data(), b.data(), n);
+                if (r != 0) { return r < 0 ? -1 : 1; }
+                return a.size() < b.size() ? -1 : (b.size() < a.size() ? 1 : 0);
+            }
+            else if constexpr (dm_is_optional_v<T>) {
+                if (a.has_value() != b.has_value()) { return a.has_value() ? 1 : -1; }
+                return a.has_value() ? compare_impl(*a, *b) : 0;
+            }
+            else if constexpr (dm_is_variant_v<T>) {
+                if (a.index() != b.index()) { return a.index() < b.index() ? -1 : 1; }
+                return compare_variant(a, b, std::make_index_sequence<std::variant_size_v<T>>());
+            }
+            else if constexpr (dm_is_tuple_like_v<T>) {
+                return compare_tuple(a, b, std::make_index_sequence<std::tuple_size_v<T>>());
+            }
+            else if constexpr (dm_is_container_v<T> || dm_is_c_array_v<T>) {
+                static_assert(!is_unordered_compare<T>::value, "dm::compare: unordered containers have no ordering");
+                auto ia = std::begin(a);
+                auto ib = std::begin(b);
+                for (; ia != std::end(a) && ib != std::end(b); ++ia, ++ib) {
+                    int r = compare_impl(*ia, *ib);
+                    if (r != 0) { return r; }
+                }
+                return ia != std::end(a) ? 1 : (ib != std::end(b) ? -1 : 0);
+            }
+            else if constexpr (compare_as_aggregate<T>()) {
+                auto ta = dm_struct_to_tuple(a);
+                auto tb = dm_struct_to_tuple(b);
+                return compare_tuple(ta, tb, std::make_index_sequence<std::tuple_size_v<decltype(ta)>>());
+            }
+            else {
+                return a < b ? -1 : (b < a ? 1 : 0);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief 按成员逐个比较两个值是否相等，遇到第一个不等的成员即返回。
+     *
+     * 没有填充的平凡类型整体一次 memcmp，这类元素的 vector/array/string 整段 memcmp；
+     * 聚合体总是按成员比较 (不调用它自己的 ==)，因此可以用来实现 operator==。
+     */
+    template <typename T>
+    bool equal(const T& a, const T& b) {
+        return detail::equal_impl(a, b);
+    }
+
+    /**
+     * @brief 按成员声明顺序做字典序比较，返回 -1/0/1。
+     *
+     * 多字节整数的 memcmp 顺序与数值顺序不一致 (小端)，只有单字节无符号元素的连续容器走 memcmp；
+     * 浮点数中的 NaN 与任何值都比较为 0。
+     */
+    template <typename T>
+    int compare(const T& a, const T& b) {
+        return detail::compare_impl(a, b);
+    }
+
+} // namespace dm
+
+#endif // __DMTYPETRAITS_COMPARE_H_INCLUDE__
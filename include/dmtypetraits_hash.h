@@ -0,0 +1,213 @@
+#ifndef __DMTYPETRAITS_HASH_H_INCLUDE__
+#define __DMTYPETRAITS_HASH_H_INCLUDE__
+
+#include "dmtypetraits_reflection.h"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace dm {
+
+    namespace detail {
+
+        //-----------------------------------------------------------------------------
+        // wyhash 风格的 64 位哈希: 以 64x64->128 位乘法折叠混合，
+        // 字节块按 16 字节一轮处理，尾部不足 8 字节时按首中尾拼读，不逐字节循环
+        //-----------------------------------------------------------------------------
+        constexpr uint64_t hash_secret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+        inline uint64_t hash_mum(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+            __uint128_t r = static_cast<__uint128_t>(a) * b;
+            return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            uint64_t hi;
+            uint64_t lo = _umul128(a, b, &hi);
+            return lo ^ hi;
+#else
+            uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+            uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+            uint64_t t = rl + (rm0 << 32);
+            uint64_t c = t < rl;
+            uint64_t lo = t + (rm1 << 32);
+            c += lo < t;
+            uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+            return lo ^ hi;
+#endif
+        }
+
+        inline uint64_t hash_read8(const unsigned char* p) {
+            uint64_t v;
+            std::memcpy(&v, p, 8);
+            return v;
+        }
+
+        inline uint64_t hash_read4(const unsigned char* p) {
+            uint32_t v;
+            std::memcpy(&v, p, 4);
+            return v;
+        }
+
+        inline uint64_t hash_bytes(const void* data, std::size_t len, uint64_t seed) {
+            const unsigned char* p = static_cast<const unsigned char*>(data);
+            seed ^= hash_mum(seed ^ hash_secret[0], hash_secret[1]);
+            uint64_t a;
+            uint64_t b;
+            if (len <= 16) {
+                if (len >= 4) {
+                    a = (hash_read4(p) << 32) | hash_read4(p + ((len >> 3) << 2));
+                    b = (hash_read4(p + len - 4) << 32) | hash_read4(p + len - 4 - ((len >> 3) << 2));
+                }
+                else if (len > 0) {
+                    a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+                    b = 0;
+                }
+                else {
+                    a = b = 0;
+                }
+            }
+            else {
+                std::size_t i = len;
+                if (i > 48) {
+                    uint64_t see1 = seed, see2 = seed;
+                    do {
+                        seed = hash_mum(hash_read8(p) ^ hash_secret[1], hash_read8(p + 8) ^ seed);
+                        see1 = hash_mum(hash_read8(p + 16) ^ hash_secret[2], hash_read8(p + 24) ^ see1);
+                        see2 = hash_mum(hash_read8(p + 32) ^ hash_secret[3], hash_read8(p + 40) ^ see2);
+                        p += 48;
+                        i -= 48;
+                    } while (i > 48);
+                    seed ^= see1 ^ see2;
+                }
+                while (i > 16) {
+                    seed = hash_mum(hash_read8(p) ^ hash_secret[1], hash_read8(p + 8) ^ seed);
+                    i -= 16;
+                    p += 16;
+                }
+                a = hash_read8(p + i - 16);
+                b = hash_read8(p + i - 8);
+            }
+            a ^= hash_secret[1];
+            b ^= seed;
+            uint64_t r = hash_mum(a, b);
+            return hash_mum(r ^ hash_secret[0] ^ len, r ^ hash_secret[1]);
+        }
+
+        // 把一个 64 位值并入状态，用于长度、标记和逐元素的组合
+        inline uint64_t hash_combine(uint64_t state, uint64_t value) {
+            return hash_mum(state ^ hash_secret[0], value ^ hash_secret[1]);
+        }
+
+        template <typename T, typename = void>
+        struct has_std_hash : std::false_type {};
+
+        template <typename T>
+        struct has_std_hash<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T&>()))>> : std::true_type {};
+
+        // 无序容器的遍历顺序与内容无关，元素哈希需要以可交换的方式合并
+        template <typename T, typename = void>
+        struct is_unordered_container : std::false_type {};
+
+        template <typename T>
+        struct is_unordered_container<T, std::void_t<typename T::hasher, typename T::key_equal>> : std::true_type {};
+
+        template <typename T>
+        constexpr bool hash_contiguous_bytes() {
+            if constexpr (dm::pack::detail::dm_pack_is_std_vector_v<T> || dm::pack::detail::dm_pack_is_std_basic_string_v<T> ||
+                dm_is_std_array_v<T>) {
+                using value_type = typename T::value_type;
+                return !dm_is_same_v<value_type, bool> && std::has_unique_object_representations_v<value_type>;
+            }
+            else { return false; }
+        }
+
+        template <typename T>
+        inline uint64_t hash_append(uint64_t state, const T& value);
+
+        template <typename Tuple, std::size_t... I>
+        inline uint64_t hash_append_tuple(uint64_t state, const Tuple& value, std::index_sequence<I...>) {
+            ((state = hash_append(state, std::get<I>(value))), ...);
+            return state;
+        }
+
+        template <typename T>
+        inline uint64_t hash_append(uint64_t state, const T& value) {
+            if constexpr (std::has_unique_object_representations_v<T>) {
+                // 没有填充且相等即逐字节相等: 整体一次哈希
+                return hash_bytes(&value, sizeof(T), state);
+            }
+            else if constexpr (std::is_floating_point_v<T>) {
+                T normalized = value == T(0) ? T(0) : value;         // -0.0 与 0.0 相等
+                return hash_bytes(&normalized, sizeof(T), state);
+            }
+            else if constexpr (dm_is_string_like_v<T>) {
+                std::string_view s(value);
+                return hash_bytes(s.data(), s.size(), state);
+            }
+            else if constexpr (hash_contiguous_bytes<T>()) {
+                return hash_bytes(value.data(), value.size() * sizeof(typename T::value_type), state);
+            }
+            else if constexpr (dm_is_optional_v<T>) {
+                if (!value) { return hash_combine(state, 0); }
+                return hash_append(hash_combine(state, 1), *value);
+            }
+            else if constexpr (dm_is_variant_v<T>) {
+                state = hash_combine(state, value.index());
+                if (value.valueless_by_exception()) { return state; }
+                return std::visit([&](const auto& alternative) { return hash_append(state, alternative); }, value);
+            }
+            else if constexpr (dm_is_tuple_like_v<T>) {
+                return hash_append_tuple(state, value, std::make_index_sequence<std::tuple_size_v<T>>());
+            }
+            else if constexpr (is_unordered_container<T>::value) {
+                uint64_t sum = 0;
+                for (const auto& element : value) { sum += hash_append(hash_secret[2], element); }
+                return hash_combine(hash_combine(state, sum), value.size());
+            }
+            else if constexpr (dm_is_container_v<T> || dm_is_c_array_v<T>) {
+                std::size_t count = 0;
+                for (const auto& element : value) {
+                    state = hash_append(state, element);
+                    ++count;
+                }
+                return hash_combine(state, count);
+            }
+            else if constexpr (has_std_hash<T>::value) {
+                return hash_combine(state, std::hash<T>{}(value));
+            }
+            else if constexpr (dm_is_class_v<T> && dm_is_aggregate_v<T>) {
+                return dm_visit_members(value, [&](const auto&... members) {
+                    ((state = hash_append(state, members)), ...);
+                    return state;
+                });
+            }
+            else {
+                static_assert(!sizeof(T), "dm::hash: the type is not supported");
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief 基于反射的哈希函数对象，可直接用作 unordered_map 的 Hash 参数。
+     *
+     * 没有填充的平凡类型整体一次哈希；其它聚合体按成员递归，字符串与连续容器按字节块哈希，
+     * 无序容器按元素哈希之和合并 (与遍历顺序无关)。相等的值哈希相同，前提是成员的 == 是逐值比较。
+     */
+    template <typename T>
+    struct hash {
+        std::size_t operator()(const T& value) const noexcept {
+            return static_cast<std::size_t>(detail::hash_append(detail::hash_secret[3], value));
+        }
+    };
+
+} // namespace dm
+
+#endif // __DMTYPETRAITS_HASH_H_INCLUDE__
@@ -0,0 +1,150 @@
+#ifndef __DMTYPETRAITS_LAYOUT_H_INCLUDE__
+#define __DMTYPETRAITS_LAYOUT_H_INCLUDE__
+
+#include "dmtypetraits_reflection.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+
+namespace dm {
+
+    namespace detail {
+
+        template <typename T>
+        using layout_members_t = decltype(dm_struct_to_tuple(std::declval<T&>()));
+
+        template <typename Tuple, std::size_t... I>
+        constexpr std::array<std::size_t, sizeof...(I)> layout_sizes(std::index_sequence<I...>) {
+            return { sizeof(dm_remove_cvref_t<std::tuple_element_t<I, Tuple>>)... };
+        }
+
+        template <typename Tuple, std::size_t... I>
+        constexpr std::array<std::size_t, sizeof...(I)> layout_aligns(std::index_sequence<I...>) {
+            return { alignof(dm_remove_cvref_t<std::tuple_element_t<I, Tuple>>)... };
+        }
+
+        constexpr std::size_t layout_align_up(std::size_t n, std::size_t align) {
+            return (n + align - 1) / align * align;
+        }
+
+        // 按声明顺序依次放置，每个成员对齐到自身类型的对齐值 (各主流 ABI 对聚合体的规则)
+        template <std::size_t N>
+        constexpr std::array<std::size_t, N> layout_offsets(const std::array<std::size_t, N>& sizes,
+            const std::array<std::size_t, N>& aligns, const std::array<std::size_t, N>& order) {
+            std::array<std::size_t, N> offsets{};
+            std::size_t end = 0;
+            for (std::size_t k = 0; k < N; ++k) {
+                std::size_t i = order[k];
+                offsets[i] = layout_align_up(end, aligns[i]);
+                end = offsets[i] + sizes[i];
+            }
+            return offsets;
+        }
+
+        template <std::size_t N>
+        constexpr std::size_t layout_size(const std::array<std::size_t, N>& sizes, const std::array<std::size_t, N>& aligns,
+            const std::array<std::size_t, N>& order) {
+            std::array<std::size_t, N> offsets = layout_offsets(sizes, aligns, order);
+            std::size_t end = 0;
+            std::size_t align = 1;
+            for (std::size_t i = 0; i < N; ++i) {
+                end = (std::max)(end, offsets[i] + sizes[i]);
+                align = (std::max)(align, aligns[i]);
+            }
+            return layout_align_up(end, align);
+        }
+
+        template <std::size_t N>
+        constexpr std::array<std::size_t, N> layout_identity() {
+            std::array<std::size_t, N> order{};
+            for (std::size_t i = 0; i < N; ++i) { order[i] = i; }
+            return order;
+        }
+
+        // 按对齐值从大到小稳定排序，对齐相同的成员保持原有先后
+        template <std::size_t N>
+        constexpr std::array<std::size_t, N> layout_by_alignment(const std::array<std::size_t, N>& aligns) {
+            std::array<std::size_t, N> order = layout_identity<N>();
+            for (std::size_t i = 1; i < N; ++i) {
+                for (std::size_t j = i; j > 0 && aligns[order[j - 1]] < aligns[order[j]]; --j) {
+                    std::size_t t = order[j];
+                    order[j] = order[j - 1];
+                    order[j - 1] = t;
+                }
+            }
+            return order;
+        }
+
+        template <typename T>
+        struct layout_info {
+            using members = layout_members_t<T>;
+            static constexpr std::size_t count = std::tuple_size_v<members>;
+            static constexpr std::array<std::size_t, count> sizes = layout_sizes<members>(std::make_index_sequence<count>());
+            static constexpr std::array<std::size_t, count> aligns = layout_aligns<members>(std::make_index_sequence<count>());
+            static constexpr std::array<std::size_t, count> offsets = layout_offsets(sizes, aligns, layout_identity<count>());
+
+            // 成员上的 alignas、基类或 [[no_unique_address]] 会使推算的布局与编译器不符
+            static_assert(layout_size(sizes, aligns, layout_identity<count>()) == sizeof(T),
+                "the layout of T cannot be derived from its member types");
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief 聚合体各成员的大小，按声明顺序。
+     */
+    template <typename T>
+    inline constexpr std::array<std::size_t, dm_member_count_v<T>> member_sizes_v = detail::layout_info<T>::sizes;
+
+    /**
+     * @brief 聚合体各成员的偏移量 (相当于逐个成员的 offsetof)，编译期常量。
+     *
+     * 由成员类型的大小与对齐按声明顺序推算，推算结果与 sizeof(T) 不符时编译失败，
+     * 因此不支持成员上带 alignas、有基类或 [[no_unique_address]] 的类型，也不支持引用成员。
+     */
+    template <typename T>
+    inline constexpr std::array<std::size_t, dm_member_count_v<T>> member_offsets_v = detail::layout_info<T>::offsets;
+
+    /**
+     * @brief 结构体的填充分析结果。
+     */
+    template <std::size_t N>
+    struct padding_report {
+        std::size_t size;                                // sizeof(T)
+        std::size_t padding;                             // 成员之间与末尾的填充字节总数
+        std::size_t tail_padding;                        // 最后一个成员之后的填充
+        std::size_t reordered_size;                      // 按 suggested_order 排列后的 sizeof
+        std::array<std::size_t, N> suggested_order;     // 建议的成员顺序 (原序号)，按对齐值从大到小
+
+        constexpr std::size_t saving() const { return size - reordered_size; }
+    };
+
+    /**
+     * @brief T 的填充分析: 填充字节数，以及把成员按对齐值从大到小重排后可以省下的字节数。
+     */
+    template <typename T>
+    constexpr padding_report<dm_member_count_v<T>> get_padding_report() {
+        using info = detail::layout_info<T>;
+        padding_report<info::count> report{};
+        std::size_t used = 0;
+        std::size_t end = 0;
+        for (std::size_t i = 0; i < info::count; ++i) {
+            used += info::sizes[i];
+            end = (std::max)(end, info::offsets[i] + info::sizes[i]);
+        }
+        report.size = sizeof(T);
+        report.padding = sizeof(T) - used;
+        report.tail_padding = sizeof(T) - end;
+        report.suggested_order = detail::layout_by_alignment(info::aligns);
+        report.reordered_size = detail::layout_size(info::sizes, info::aligns, report.suggested_order);
+        return report;
+    }
+
+    template <typename T>
+    inline constexpr padding_report<dm_member_count_v<T>> padding_report_v = get_padding_report<T>();
+
+} // namespace dm
+
+#endif // __DMTYPETRAITS_LAYOUT_H_INCLUDE__
@@ -18,6 +18,16 @@ struct deserialize_result {
   T value;
 };
 
+/**
+ * @brief 解码时允许新分配的内存上限 (字节)。
+ *
+ * 按元素大小 (节点式容器另加节点开销) 估算，超出时解码返回 std::errc::not_enough_memory，
+ * 用于限制不可信输入通过伪造长度造成的内存放大。
+ */
+struct memory_budget {
+  std::size_t bytes;
+};
+
 template <typename T>
 struct compatible : public std::optional<T> {
   using base = std::optional<T>;
@@ -31,21 +41,190 @@ struct compatible : public std::optional<T> {
   constexpr compatible &operator=(compatible &&other) = default;
 };
 
+/**
+ * @brief 以 delta + 位压缩方式序列化的整数数组。
+ *
+ * 用法与 std::vector<T> 相同，适合单调或缓变的时间戳、id、计数器等序列。
+ * 相邻元素的差值按块做帧参考编码，每块只占用所需的最少位宽。
+ */
+template <typename T>
+struct delta_vector : public std::vector<T> {
+  static_assert(dm_is_integral_v<T> && !dm_is_same_v<T, bool>,
+                "delta_vector only supports integral element types");
+  using base = std::vector<T>;
+  using base::base;
+  delta_vector() = default;
+  delta_vector(const delta_vector &other) = default;
+  delta_vector(delta_vector &&other) = default;
+  delta_vector(const base &other) : base(other){};
+  delta_vector(base &&other) : base(std::move(other)){};
+  delta_vector &operator=(const delta_vector &other) = default;
+  delta_vector &operator=(delta_vector &&other) = default;
+};
+
+/**
+ * @brief 以 XOR (Gorilla) 方式序列化的浮点数组。
+ *
+ * 用法与 std::vector<T> 相同，适合变化缓慢的传感器读数等序列。
+ * 每个值与前一个值按位异或后只写出有效位，解码结果与原值逐位相同。
+ */
+template <typename T>
+struct xor_vector : public std::vector<T> {
+  static_assert(dm_is_same_v<T, float> || dm_is_same_v<T, double>,
+                "xor_vector only supports float and double");
+  using base = std::vector<T>;
+  using base::base;
+  xor_vector() = default;
+  xor_vector(const xor_vector &other) = default;
+  xor_vector(xor_vector &&other) = default;
+  xor_vector(const base &other) : base(other){};
+  xor_vector(base &&other) : base(std::move(other)){};
+  xor_vector &operator=(const xor_vector &other) = default;
+  xor_vector &operator=(xor_vector &&other) = default;
+};
+
+/**
+ * @brief 声明了最大长度 N 的字符串或容器，线上格式与 Container 完全相同。
+ *
+ * 成员全部有界的类型可以在编译期由 max_size_v<T> 得到最坏情况下的编码长度，
+ * 并用 serialize_to(std::array<char, max_size_v<T>>&, t) 直接写入栈上的缓冲区。
+ * 序列化时长度超过 N 视为错误；反序列化时长度超过 N 返回 std::errc::invalid_argument。
+ */
+template <typename Container, std::size_t N>
+struct bounded : public Container {
+  static_assert(dm_is_container_v<Container> &&
+                    !detail::dm_pack_is_delta_vector_v<Container> &&
+                    !detail::dm_pack_is_xor_vector_v<Container> &&
+                    !detail::dm_pack_is_bool_vector_v<Container>,
+                "bounded only supports strings and element-wise containers");
+  static_assert(N <= MAX_SIZE, "the bound exceeds the maximum container size");
+  static constexpr std::size_t max_length = N;
+  using base = Container;
+  using base::base;
+  bounded() = default;
+  bounded(const bounded &other) = default;
+  bounded(bounded &&other) = default;
+  bounded(const base &other) : base(other){};
+  bounded(base &&other) : base(std::move(other)){};
+  bounded &operator=(const bounded &other) = default;
+  bounded &operator=(bounded &&other) = default;
+};
+
+/**
+ * @brief 字符串表: 所有字符连续存放在一块内存中，另有一个偏移数组，按下标取出 std::string_view。
+ *
+ * 线上格式与 std::vector<std::string> 相同，两者写出的数据可以互相解码。
+ * 解码 n 个字符串只分配两次内存 (字符与偏移)，适合标签列表等大量短字符串。
+ */
+class string_table : public detail::flat_table<char, std::string_view> {
+public:
+  string_table() = default;
+  string_table(std::initializer_list<std::string_view> list) {
+    for (std::string_view s : list) { push_back(s); }
+  }
+
+  void push_back(std::string_view s) { append(s.data(), s.size()); }
+};
+
+/**
+ * @brief 以 CSR 方式存放的变长二维数组，每行是一个 jagged<T>::row (指针 + 长度)。
+ *
+ * 线上格式与 std::vector<std::vector<T>> 相同，两者写出的数据可以互相解码。
+ * 解码只分配两次内存 (元素与偏移)，适合倒排索引的 posting list 等大量短行。
+ */
+template <typename T>
+class jagged : public detail::flat_table<T, detail::flat_row<T>> {
+  static_assert(detail::dm_pack_raw_v<T> && !dm_is_same_v<T, bool>,
+                "jagged only supports trivially copyable element types other than bool");
+
+public:
+  using row = detail::flat_row<T>;
+
+  jagged() = default;
+  jagged(std::initializer_list<std::initializer_list<T>> rows) {
+    for (const auto &r : rows) { push_back(r); }
+  }
+
+  template <typename Range>
+  void push_back(const Range &range) {
+    this->append(std::data(range), std::size(range));
+  }
+  void push_back(std::initializer_list<T> range) {
+    this->append(range.begin(), range.size());
+  }
+};
+
+/**
+ * @brief 去除填充的选择标记。
+ *
+ * 平凡可拷贝的结构体默认整块 memcpy，成员之间和末尾的填充字节 (未初始化) 也一起写出。
+ * 在结构体内声明 using codec_t = dm::pack::packed_codec; 后，只按成员顺序写出各成员的字节，
+ * 线上更短且内容确定，可以直接对编码结果做哈希或去重。没有填充的类型仍整块 memcpy，声明与否结果相同。
+ * 类型码与整块存放时不同，migrator 可以在两种布局之间迁移。
+ */
+struct packed_codec {};
+
+/**
+ * @brief 表驱动编解码的选择标记。
+ *
+ * 在结构体内声明 using codec_t = dm::pack::compact_codec; 后，该类型不再逐成员内联展开，
+ * 而是按首次使用时生成的成员表由共享的解释器编解码，适合消息类型很多、代码体积敏感的场景。
+ * 线上格式不变；平凡可拷贝的结构体始终整块 memcpy，声明与否没有区别。
+ */
+struct compact_codec {};
+
 template <typename... Args>
 DMPACK_INLINE constexpr std::size_t get_type_code() {
   static_assert(sizeof...(Args) > 0);
   if constexpr (sizeof...(Args) == 1) {
-    return detail::get_types_code<decltype(detail::get_types(
-        std::declval<Args...>()))>();
+    return detail::get_types_code<
+        detail::top_level_types_t<std::tuple_element_t<0, std::tuple<Args...>>>>();
   }
   else {
     return detail::get_types_code<std::tuple<Args...>>();
   }
 }
 
+/**
+ * @brief 返回 T 的类型描述串，get_type_code<T>() 即由它的 MD5 得到。
+ *
+ * 写入端可把它随文件或数据流保存一次，结构体升级后读取端用它构造 migrator 解码旧数据。
+ */
+template <typename T>
+DMPACK_INLINE std::string_view get_type_literal() {
+  using types = detail::top_level_types_t<T>;
+  static constexpr auto literal = detail::get_tuple_types_literal<types>(
+      dm_make_index_sequence<std::tuple_size_v<types>>());
+  return {literal.data(), literal.size()};
+}
+
+/**
+ * @brief T 的编码长度是否有编译期上限: 字符串和容器都声明为 bounded 时成立。
+ */
+template <typename T>
+inline constexpr bool is_bounded_v =
+    detail::max_wire_size<T>() != detail::unbounded_size;
+
+/**
+ * @brief serialize(t) 在最坏情况下写出的字节数 (含类型头)，编译期常量。
+ */
+template <typename T>
+constexpr std::size_t max_size() {
+  static_assert(is_bounded_v<T>,
+                "the type contains an unbounded string or container, declare "
+                "its maximum length with dm::pack::bounded");
+  static_assert(detail::unexist_compatible_member_v<T>,
+                "compatible<T> is not supported by max_size");
+  return detail::max_wire_size<T>() + sizeof(uint32_t);
+}
+
+template <typename T>
+inline constexpr std::size_t max_size_v = max_size<T>();
+
 template <typename... Args>
-[[nodiscard]] DMPACK_INLINE constexpr size_t get_needed_size(
+[[nodiscard]] DMPACK_INLINE size_t get_needed_size(
     const Args &...args) {
+  [[maybe_unused]] detail::ref_scope<detail::dm_pack_has_shared_ptr_v<Args...>> refs;
   if constexpr ((detail::unexist_compatible_member_v<Args> && ...))
     return detail::calculate_needed_size(args...) + sizeof(uint32_t);
   else
@@ -56,7 +235,7 @@ template <typename... Args>
 template <typename Byte, typename... Args,
           typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
 std::size_t DMPACK_INLINE serialize_to(Byte *buffer, std::size_t len,
-                                      const Args &...args) noexcept {
+                                      const Args &...args) {
   static_assert(sizeof...(args) > 0);
   auto size = get_needed_size(args...);
   if (size > len) [[unlikely]] {
@@ -72,6 +251,22 @@ std::size_t DMPACK_INLINE serialize_to(Byte *buffer, std::size_t len,
   return size;
 }
 
+/**
+ * @brief 把有界类型写入定长缓冲区 (通常在栈上)，返回写出的字节数。
+ *
+ * 缓冲区长度在编译期与 max_size_v<T> 比较，不做运行期的长度计算，也不分配内存。
+ */
+template <typename T, typename Byte, std::size_t N,
+          typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
+std::size_t DMPACK_INLINE serialize_to(std::array<Byte, N> &buffer,
+                                      const T &t) {
+  static_assert(N >= max_size_v<T>,
+                "the buffer is smaller than max_size_v<T>");
+  detail::packer<Byte> o(buffer.data());
+  o.serialize(t);
+  return o.size();
+}
+
 template <typename Buffer, typename... Args,
           typename = std::enable_if_t<detail::dm_pack_buffer_v<Buffer>>>
 void DMPACK_INLINE serialize_to(Buffer &buffer, const Args &...args) {
@@ -156,6 +351,24 @@ template <typename T, typename Byte,
   return in.deserialize(t, consume_len);
 }
 
+template <typename T, typename View,
+          typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
+[[nodiscard]] DMPACK_INLINE std::errc deserialize_to(T &t, const View &v,
+                                                    memory_budget budget) {
+  detail::unpacker<typename View::value_type> in(v.data(), v.size(), budget.bytes);
+  return in.deserialize(t);
+}
+
+template <typename T, typename Byte,
+          typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
+[[nodiscard]] DMPACK_INLINE std::errc deserialize_to(T &t,
+                                                    const Byte *data,
+                                                    size_t size,
+                                                    memory_budget budget) {
+  detail::unpacker<Byte> in(data, size, budget.bytes);
+  return in.deserialize(t);
+}
+
 template <typename T, typename View,
           typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
 [[nodiscard]] DMPACK_INLINE std::errc deserialize_to_with_offset(
@@ -215,6 +428,24 @@ template <typename T, typename Byte,
   return ret;
 }
 
+template <typename T, typename View,
+          typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
+[[nodiscard]] DMPACK_INLINE deserialize_result<T> deserialize(
+    const View &v, memory_budget budget) {
+  deserialize_result<T> ret;
+  ret.errc = deserialize_to(ret.value, v, budget);
+  return ret;
+}
+
+template <typename T, typename Byte,
+          typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
+[[nodiscard]] DMPACK_INLINE deserialize_result<T> deserialize(
+    const Byte *data, size_t size, memory_budget budget) {
+  deserialize_result<T> ret;
+  ret.errc = deserialize_to(ret.value, data, size, budget);
+  return ret;
+}
+
 template <typename T, typename View,
           typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
 [[nodiscard]] DMPACK_INLINE deserialize_result<T> deserialize_with_offset(
@@ -233,6 +464,48 @@ template <typename T, typename Byte,
   return ret;
 }
 
+/**
+ * @brief 校验一段不可信的 dm::pack 数据能否按 T 解码，不分配内存也不构造 T。
+ *
+ * 检查类型码、各级长度、variant 下标、bool 与声明了 enum_range 的枚举取值，
+ * 以及嵌套深度 (DMPACK_MAX_DEPTH)。通过校验的数据解码时不会再因格式出错 (内存预算除外)。
+ */
+template <typename T, typename View,
+          typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
+[[nodiscard]] DMPACK_INLINE std::errc validate(const View &v) {
+  detail::unpacker<typename View::value_type> in(v.data(), v.size());
+  return in.template validate<T>();
+}
+
+template <typename T, typename Byte,
+          typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
+[[nodiscard]] DMPACK_INLINE std::errc validate(const Byte *data, size_t size) {
+  detail::unpacker<Byte> in(data, size);
+  return in.template validate<T>();
+}
+
+/**
+ * @brief 按编译期字段路径只解码一个嵌套字段，如 get_path<ComplexData, 2, 1>(buf)。
+ *
+ * 结构体/tuple 的下标选择成员，数组与顺序容器的下标选择元素。
+ * 路径之外的字段只按长度头跳过，不会构造。
+ */
+template <typename T, size_t... Path, typename View,
+          typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
+[[nodiscard]] DMPACK_INLINE deserialize_result<detail::path_field_t<T, Path...>>
+get_path(const View &v) {
+  detail::unpacker<typename View::value_type> in(v.data(), v.size());
+  return in.template get_path<T, Path...>();
+}
+
+template <typename T, size_t... Path, typename Byte,
+          typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
+[[nodiscard]] DMPACK_INLINE deserialize_result<detail::path_field_t<T, Path...>>
+get_path(const Byte *data, size_t size) {
+  detail::unpacker<Byte> in(data, size);
+  return in.template get_path<T, Path...>();
+}
+
 template <typename T, size_t I, typename View,
           typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
 [[nodiscard]] DMPACK_INLINE decltype(auto) get_field(const View &v) {
@@ -0,0 +1,197 @@
+#ifndef __DMTYPETRAITS_PACK_CHANNEL_H_INCLUDE__
+#define __DMTYPETRAITS_PACK_CHANNEL_H_INCLUDE__
+
+#include "dmtypetraits_pack.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace dm::pack {
+
+    /**
+     * @brief 单生产者/单消费者的无锁消息通道，消息直接序列化进环形缓冲区。
+     *
+     * 生产者按 get_needed_size 在环上预留一段连续空间，原地序列化后以 release 写发布；
+     * 消费者以 acquire 读取后直接在环上反序列化，省去中间 vector 的分配与拷贝。
+     * 每条消息前有 4 字节的长度头，按 4 字节对齐；环尾剩余空间不足时写入回绕标记，从环首继续。
+     *
+     * 只允许一个线程调用 try_send，一个线程调用 try_receive/try_dispatch/peek_type_code/pop。
+     * 消息在 pop 后即被覆盖，解码目标中不能含有指向缓冲区的 string_view。
+     */
+    class channel {
+    public:
+        // capacity 向上取整为 2 的幂 (至少 64 字节)，单条消息连同长度头不能超过它
+        explicit channel(std::size_t capacity) {
+            capacity_ = 64;
+            while (capacity_ < capacity) { capacity_ <<= 1; }
+            mask_ = capacity_ - 1;
+            buffer_.reset(new char[capacity_]);
+        }
+
+        channel(const channel&) = delete;
+        channel& operator=(const channel&) = delete;
+
+        std::size_t capacity() const { return capacity_; }
+
+        /**
+         * @brief 序列化 args 并发布为一条消息；空间不足时返回 false，不阻塞。
+         */
+        template <typename... Args>
+        bool try_send(const Args&... args) {
+            static_assert(sizeof...(args) > 0);
+            std::size_t size = get_needed_size(args...);
+            char* out = reserve(size);
+            if (out == nullptr) { return false; }
+            detail::packer<char> o(out);
+            if constexpr ((detail::unexist_compatible_member_v<Args> && ...)) { o.serialize(args...); }
+            else { o.serialize_with_size(size, args...); }
+            head_.store(reserved_head_, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief 读取队首消息的类型码 (get_type_code)，用于按类型分派；通道为空时返回 false。
+         */
+        bool peek_type_code(uint32_t& code) {
+            record r;
+            if (!front(r) || r.size < sizeof(uint32_t)) { return false; }
+            std::memcpy(&code, r.data, sizeof(uint32_t));
+            return true;
+        }
+
+        /**
+         * @brief 把队首消息解码到 t 并出队。
+         *
+         * 通道为空时返回 std::errc::resource_unavailable_try_again；
+         * 类型码不是 T 时返回 std::errc::invalid_argument 且消息保留在队首，可换一个类型读取或 pop 丢弃。
+         */
+        template <typename T>
+        std::errc try_receive(T& t) {
+            record r;
+            if (!front(r)) { return std::errc::resource_unavailable_try_again; }
+            if (!matches<T>(r)) { return std::errc::invalid_argument; }
+            std::errc code = deserialize_to(t, r.data, r.size);
+            release(r);
+            return code;
+        }
+
+        /**
+         * @brief 按类型码在 Ts 中找到队首消息的类型，解码后以该类型的值调用 f 并出队。
+         *
+         * 返回值同 try_receive；没有匹配的类型时消息保留在队首。
+         */
+        template <typename... Ts, typename F>
+        std::errc try_dispatch(F&& f) {
+            static_assert(sizeof...(Ts) > 0);
+            record r;
+            if (!front(r)) { return std::errc::resource_unavailable_try_again; }
+            bool found = false;
+            std::errc code = std::errc::invalid_argument;
+            ((matches<Ts>(r) ? (found = true, code = dispatch_one<Ts>(r, f), true) : false) || ...);
+            if (found) { release(r); }
+            return code;
+        }
+
+        /**
+         * @brief 丢弃队首消息；通道为空时返回 false。
+         */
+        bool pop() {
+            record r;
+            if (!front(r)) { return false; }
+            release(r);
+            return true;
+        }
+
+        bool empty() const {
+            return tail_.load(std::memory_order_relaxed) == head_.load(std::memory_order_acquire);
+        }
+
+    private:
+        static constexpr uint32_t wrap_marker = UINT32_MAX;
+
+        struct record {
+            const char* data;
+            uint32_t size;
+            uint64_t next;                                   // 出队后的读位置
+        };
+
+        static constexpr std::size_t align4(std::size_t n) { return (n + 3) & ~std::size_t{ 3 }; }
+
+        template <typename T>
+        static bool matches(const record& r) {
+            if (r.size < sizeof(uint32_t)) { return false; }
+            uint32_t code = 0;
+            std::memcpy(&code, r.data, sizeof(uint32_t));
+            return code / 2 == static_cast<uint32_t>(get_type_code<T>()) / 2;
+        }
+
+        template <typename T, typename F>
+        static std::errc dispatch_one(const record& r, F& f) {
+            T value{};
+            std::errc code = deserialize_to(value, r.data, r.size);
+            if (code == std::errc{}) { f(value); }
+            return code;
+        }
+
+        // 生产者: 预留 size 字节的连续空间，必要时先写回绕标记跳过环尾
+        char* reserve(std::size_t size) {
+            std::size_t need = align4(sizeof(uint32_t) + size);
+            if (need > capacity_ || size > UINT32_MAX - sizeof(uint32_t)) [[unlikely]] { return nullptr; }
+            uint64_t head = head_.load(std::memory_order_relaxed);
+            std::size_t offset = static_cast<std::size_t>(head & mask_);
+            std::size_t contiguous = capacity_ - offset;
+            std::size_t total = need <= contiguous ? need : contiguous + need;
+            if (capacity_ - (head - cached_tail_) < total) {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                if (capacity_ - (head - cached_tail_) < total) { return nullptr; }
+            }
+            if (need > contiguous) {
+                std::memcpy(buffer_.get() + offset, &wrap_marker, sizeof(uint32_t));
+                head += contiguous;
+                offset = 0;
+            }
+            uint32_t len = static_cast<uint32_t>(size);
+            std::memcpy(buffer_.get() + offset, &len, sizeof(uint32_t));
+            reserved_head_ = head + need;
+            return buffer_.get() + offset + sizeof(uint32_t);
+        }
+
+        // 消费者: 取队首消息，跳过回绕标记
+        bool front(record& r) {
+            uint64_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail == cached_head_) {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                if (tail == cached_head_) { return false; }
+            }
+            std::size_t offset = static_cast<std::size_t>(tail & mask_);
+            uint32_t len = 0;
+            std::memcpy(&len, buffer_.get() + offset, sizeof(uint32_t));
+            if (len == wrap_marker) {
+                tail += capacity_ - offset;
+                offset = 0;
+                std::memcpy(&len, buffer_.get(), sizeof(uint32_t));
+            }
+            r.data = buffer_.get() + offset + sizeof(uint32_t);
+            r.size = len;
+            r.next = tail + align4(sizeof(uint32_t) + len);
+            return true;
+        }
+
+        void release(const record& r) { tail_.store(r.next, std::memory_order_release); }
+
+        std::unique_ptr<char[]> buffer_;
+        std::size_t capacity_ = 0;
+        std::size_t mask_ = 0;
+
+        // 读写位置单调递增，各占一个缓存行，避免生产者与消费者之间的伪共享
+        alignas(64) std::atomic<uint64_t> head_{ 0 };
+        uint64_t cached_tail_ = 0;                           // 生产者缓存的读位置
+        uint64_t reserved_head_ = 0;
+        alignas(64) std::atomic<uint64_t> tail_{ 0 };
+        uint64_t cached_head_ = 0;                           // 消费者缓存的写位置
+    };
+
+} // namespace dm::pack
+
+#endif // __DMTYPETRAITS_PACK_CHANNEL_H_INCLUDE__
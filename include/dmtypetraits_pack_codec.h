@@ -0,0 +1,693 @@
+#ifndef __DMTYPETRAITS_PACK_CODEC_H_INCLUDE__
+#define __DMTYPETRAITS_PACK_CODEC_H_INCLUDE__
+
+#include "dmtypetraits_reflection.h"
+
+#include <bitset>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+// libstdc++ 的 vector<bool> 以 _Bit_type 字数组存放，可经迭代器的 _M_p 取得底层存储；
+// 其它标准库没有可用的入口。存储的位序在运行期探测，见 bool_vector_storage_matches
+#if defined(__GLIBCXX__)
+#define DMPACK_BOOL_VECTOR_STORAGE 1
+#else
+#define DMPACK_BOOL_VECTOR_STORAGE 0
+#endif
+
+namespace dm::pack {
+    namespace detail {
+
+        // 返回表示 v 所需的最少比特数 (v == 0 时为 0)
+        DMPACK_INLINE unsigned bit_width_u64(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+            return v ? 64u - static_cast<unsigned>(__builtin_clzll(v)) : 0u;
+#else
+            unsigned n = 0;
+            while (v) { v >>= 1; ++n; }
+            return n;
+#endif
+        }
+
+        // 从 p 处读取至多 8 个字节 (小端)，不足部分补零，用于块尾的安全读取
+        template <typename Byte>
+        DMPACK_INLINE uint64_t load_u64_partial(const Byte* p, std::size_t avail) {
+            uint64_t v = 0;
+            std::memcpy(&v, p, avail < sizeof(uint64_t) ? avail : sizeof(uint64_t));
+            return v;
+        }
+
+        //-----------------------------------------------------------------------------
+        // 比特流写入器: 以 64 位字为单位累积，再整字写出
+        //-----------------------------------------------------------------------------
+        template <typename Byte>
+        class bit_writer {
+        public:
+            explicit bit_writer(Byte* out) : out_(out) {}
+
+            // 写入 v 的低 width 位 (width <= 64, 高位必须为 0)
+            DMPACK_INLINE void write(uint64_t v, unsigned width) {
+                if (width == 0) { return; }
+                acc_ |= v << bits_;
+                if (bits_ + width >= 64) {
+                    std::memcpy(out_ + pos_, &acc_, sizeof(uint64_t));
+                    pos_ += sizeof(uint64_t);
+                    acc_ = bits_ ? (v >> (64 - bits_)) : 0;
+                    bits_ = bits_ + width - 64;
+                }
+                else {
+                    bits_ += width;
+                }
+            }
+
+            // 将剩余不足一个字的比特按字节写出，返回总字节数
+            DMPACK_INLINE std::size_t flush() {
+                std::size_t tail = (bits_ + 7) / 8;
+                std::memcpy(out_ + pos_, &acc_, tail);
+                pos_ += tail;
+                acc_ = 0;
+                bits_ = 0;
+                return pos_;
+            }
+
+        private:
+            Byte* out_;
+            std::size_t pos_{};
+            uint64_t acc_{};
+            unsigned bits_{};
+        };
+
+        // 只统计比特数、不写出数据的写入器，用于预先计算编码长度
+        class bit_counter {
+        public:
+            DMPACK_INLINE void write(uint64_t, unsigned width) { bits_ += width; }
+            DMPACK_INLINE std::size_t flush() { return static_cast<std::size_t>((bits_ + 7) / 8); }
+
+        private:
+            uint64_t bits_{};
+        };
+
+        //-----------------------------------------------------------------------------
+        // 比特流读取器: 与 bit_writer 的位序一致，越界时置错误标志并返回 0
+        //-----------------------------------------------------------------------------
+        template <typename Byte>
+        class bit_reader {
+        public:
+            bit_reader(const Byte* in, std::size_t size) : in_(in), size_(size), limit_(static_cast<uint64_t>(size) * 8) {}
+
+            DMPACK_INLINE uint64_t read(unsigned width) {
+                if (width == 0) { return 0; }
+                if (bit_ + width > limit_) [[unlikely]] {
+                    error_ = true;
+                    return 0;
+                }
+                std::size_t byte = static_cast<std::size_t>(bit_ >> 3);
+                unsigned shift = static_cast<unsigned>(bit_ & 7);
+                uint64_t v = load_u64_partial(in_ + byte, size_ - byte) >> shift;
+                if (shift + width > 64) {
+                    v |= static_cast<uint64_t>(static_cast<uint8_t>(in_[byte + 8])) << (64 - shift);
+                }
+                bit_ += width;
+                return width == 64 ? v : (v & ((uint64_t{ 1 } << width) - 1));
+            }
+
+            DMPACK_INLINE bool error() const { return error_; }
+
+        private:
+            const Byte* in_;
+            std::size_t size_;
+            uint64_t limit_;
+            uint64_t bit_{};
+            bool error_{};
+        };
+
+        DMPACK_INLINE unsigned trailing_zeros_u64(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+            return v ? static_cast<unsigned>(__builtin_ctzll(v)) : 64u;
+#else
+            if (!v) { return 64u; }
+            unsigned n = 0;
+            while (!(v & 1)) { v >>= 1; ++n; }
+            return n;
+#endif
+        }
+
+        //-----------------------------------------------------------------------------
+        // 整数序列的 delta + 帧参考 (frame-of-reference) 位压缩编码
+        //
+        // 线上格式 (count 已由调用方以 size_type 写出):
+        //   count == 0 : 无后续数据
+        //   uint64 base                      第一个元素
+        //   之后 count-1 个差值按 delta_block_size 分块，每块:
+        //   uint8  width                     (d - min) 的位宽
+        //   uint64 min                       块内最小差值 (按有符号解释)
+        //   byte   packed[(n*width+7)/8]      小端位序紧密排列的 (d - min)
+        //-----------------------------------------------------------------------------
+        constexpr std::size_t delta_block_size = 128;
+        constexpr std::size_t delta_block_header_size = sizeof(uint8_t) + sizeof(uint64_t);
+
+        template <typename T>
+        DMPACK_INLINE uint64_t delta_to_u64(T v) {
+            if constexpr (dm_is_signed_v<T>) { return static_cast<uint64_t>(static_cast<int64_t>(v)); }
+            else { return static_cast<uint64_t>(v); }
+        }
+
+        struct delta_block_info {
+            uint64_t min;
+            unsigned width;
+        };
+
+        // 扫描一个块的差值，求最小值与位宽。prev 为块前一个元素
+        template <typename T>
+        DMPACK_INLINE delta_block_info delta_scan_block(const T* data, std::size_t n, uint64_t prev) {
+            int64_t min_d = INT64_MAX;
+            int64_t max_d = INT64_MIN;
+            for (std::size_t i = 0; i < n; ++i) {
+                uint64_t cur = delta_to_u64(data[i]);
+                int64_t d = static_cast<int64_t>(cur - prev);
+                min_d = d < min_d ? d : min_d;
+                max_d = d > max_d ? d : max_d;
+                prev = cur;
+            }
+            uint64_t range = static_cast<uint64_t>(max_d) - static_cast<uint64_t>(min_d);
+            return { static_cast<uint64_t>(min_d), bit_width_u64(range) };
+        }
+
+        // count 个元素编码后至少占用的字节数 (全部块位宽为 0)，解码前据此拒绝伪造的 count
+        DMPACK_INLINE constexpr std::size_t delta_min_encoded_size(std::size_t count) {
+            if (count == 0) { return 0; }
+            return sizeof(uint64_t) + (count - 1 + delta_block_size - 1) / delta_block_size * delta_block_header_size;
+        }
+
+        template <typename T>
+        std::size_t delta_encoded_size(const T* data, std::size_t count) {
+            if (count == 0) { return 0; }
+            std::size_t total = sizeof(uint64_t);
+            uint64_t prev = delta_to_u64(data[0]);
+            for (std::size_t i = 1; i < count; i += delta_block_size) {
+                std::size_t n = count - i < delta_block_size ? count - i : delta_block_size;
+                auto info = delta_scan_block(data + i, n, prev);
+                total += delta_block_header_size + (n * info.width + 7) / 8;
+                prev = delta_to_u64(data[i + n - 1]);
+            }
+            return total;
+        }
+
+        template <typename T, typename Byte>
+        std::size_t delta_encode(const T* data, std::size_t count, Byte* out) {
+            if (count == 0) { return 0; }
+            std::size_t pos = 0;
+            uint64_t prev = delta_to_u64(data[0]);
+            std::memcpy(out + pos, &prev, sizeof(uint64_t));
+            pos += sizeof(uint64_t);
+            for (std::size_t i = 1; i < count; i += delta_block_size) {
+                std::size_t n = count - i < delta_block_size ? count - i : delta_block_size;
+                auto info = delta_scan_block(data + i, n, prev);
+                uint8_t width = static_cast<uint8_t>(info.width);
+                std::memcpy(out + pos, &width, sizeof(uint8_t));
+                std::memcpy(out + pos + sizeof(uint8_t), &info.min, sizeof(uint64_t));
+                pos += delta_block_header_size;
+                bit_writer<Byte> w(out + pos);
+                for (std::size_t j = 0; j < n; ++j) {
+                    uint64_t cur = delta_to_u64(data[i + j]);
+                    w.write(cur - prev - info.min, info.width);
+                    prev = cur;
+                }
+                pos += w.flush();
+            }
+            return pos;
+        }
+
+        template <typename Byte>
+        DMPACK_INLINE uint64_t load_u64(const Byte* p) {
+            uint64_t v;
+            std::memcpy(&v, p, sizeof(uint64_t));
+            return v;
+        }
+
+        // 位宽不超过该值时，任一值连同字节内的移位 (至多 7 位) 都落在一个 8 字节窗口内
+        constexpr unsigned delta_window_width = 64 - 7;
+
+        // 解码一个块，先取出全部差值再做前缀和:
+        //   位宽 <= 57: 定长读取 8 字节后移位、掩码，循环内无分支也无变长 memcpy；
+        //               窗口会越过块尾的最后几个值单独按剩余字节读取
+        //   位宽 58..64: 值可能跨 9 个字节，另用一个循环拼接第 9 个字节
+        // 前缀和逐个依赖前一个值，只能顺序执行
+        template <typename T, typename Byte>
+        DMPACK_INLINE void delta_unpack_block(const Byte* packed, std::size_t packed_size, std::size_t n,
+            unsigned width, uint64_t min, uint64_t& prev, T* out) {
+            if (width == 0) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    prev += min;
+                    out[j] = static_cast<T>(prev);
+                }
+                return;
+            }
+            uint64_t deltas[delta_block_size];
+            const uint64_t mask = width == 64 ? ~uint64_t{ 0 } : ((uint64_t{ 1 } << width) - 1);
+            if (width <= delta_window_width) {
+                // 满足 j * width / 8 + 8 <= packed_size 的值可以定长读取
+                std::size_t fast = packed_size < sizeof(uint64_t) ? 0 : (8 * (packed_size - 7) - 1) / width + 1;
+                fast = fast < n ? fast : n;
+                for (std::size_t j = 0; j < fast; ++j) {
+                    std::size_t bit = j * width;
+                    deltas[j] = (load_u64(packed + (bit >> 3)) >> (bit & 7)) & mask;
+                }
+                for (std::size_t j = fast; j < n; ++j) {
+                    std::size_t bit = j * width;
+                    std::size_t byte = bit >> 3;
+                    deltas[j] = (load_u64_partial(packed + byte, packed_size - byte) >> (bit & 7)) & mask;
+                }
+            }
+            else {
+                // 满足 j * width / 8 + 9 <= packed_size 的值可以定长读取 9 个字节
+                std::size_t fast = packed_size <= sizeof(uint64_t) ? 0 : (8 * (packed_size - 8) - 1) / width + 1;
+                fast = fast < n ? fast : n;
+                for (std::size_t j = 0; j < fast; ++j) {
+                    std::size_t bit = j * width;
+                    std::size_t byte = bit >> 3;
+                    unsigned shift = static_cast<unsigned>(bit & 7);
+                    uint64_t hi = static_cast<uint8_t>(packed[byte + 8]);
+                    // shift 为 0 时第 9 个字节整体移出
+                    deltas[j] = ((load_u64(packed + byte) >> shift) | ((hi << 1) << (63 - shift))) & mask;
+                }
+                for (std::size_t j = fast; j < n; ++j) {
+                    std::size_t bit = j * width;
+                    std::size_t byte = bit >> 3;
+                    unsigned shift = static_cast<unsigned>(bit & 7);
+                    uint64_t lo = load_u64_partial(packed + byte, packed_size - byte);
+                    uint64_t hi = byte + 8 < packed_size ? static_cast<uint8_t>(packed[byte + 8]) : 0;
+                    deltas[j] = ((lo >> shift) | ((hi << 1) << (63 - shift))) & mask;
+                }
+            }
+            for (std::size_t j = 0; j < n; ++j) {
+                prev += deltas[j] + min;
+                out[j] = static_cast<T>(prev);
+            }
+        }
+
+        // 解码 count 个元素到 out (out 可为 nullptr 表示只跳过)，consumed 返回读取的字节数
+        template <typename T, typename Byte>
+        std::errc delta_decode(const Byte* in, std::size_t avail, std::size_t count, T* out, std::size_t& consumed) {
+            consumed = 0;
+            if (count == 0) { return {}; }
+            if (avail < sizeof(uint64_t)) [[unlikely]] { return std::errc::no_buffer_space; }
+            std::size_t pos = 0;
+            uint64_t prev{};
+            std::memcpy(&prev, in, sizeof(uint64_t));
+            pos += sizeof(uint64_t);
+            if (out) { out[0] = static_cast<T>(prev); }
+            for (std::size_t i = 1; i < count; i += delta_block_size) {
+                std::size_t n = count - i < delta_block_size ? count - i : delta_block_size;
+                if (pos + delta_block_header_size > avail) [[unlikely]] { return std::errc::no_buffer_space; }
+                uint8_t width{};
+                uint64_t min{};
+                std::memcpy(&width, in + pos, sizeof(uint8_t));
+                std::memcpy(&min, in + pos + sizeof(uint8_t), sizeof(uint64_t));
+                pos += delta_block_header_size;
+                if (width > 64) [[unlikely]] { return std::errc::invalid_argument; }
+                std::size_t packed_size = (n * width + 7) / 8;
+                if (pos + packed_size > avail) [[unlikely]] { return std::errc::no_buffer_space; }
+                if (out) { delta_unpack_block(in + pos, packed_size, n, width, min, prev, out + i); }
+                pos += packed_size;
+            }
+            consumed = pos;
+            return {};
+        }
+
+
+        //-----------------------------------------------------------------------------
+        // 浮点序列的 XOR (Gorilla) 编码
+        //
+        // 第一个值原样写出 B 位 (float: 32, double: 64)。之后每个值与前一个值异或:
+        //   异或为 0                 : '0'
+        //   有效位落在上一个窗口内   : '1' '0' + 窗口内的有效位
+        //   否则                     : '1' '1' + 前导零个数 (L 位) + (有效位长度 - 1) (L 位) + 有效位
+        // 其中 L = log2(B)。编码按位逐值进行，因此编码器与解码器都可以流式使用。
+        //-----------------------------------------------------------------------------
+        template <typename T>
+        struct xor_float_traits;
+
+        template <>
+        struct xor_float_traits<float> {
+            using bits_type = uint32_t;
+            static constexpr unsigned bits = 32;
+            static constexpr unsigned field_bits = 5;
+        };
+
+        template <>
+        struct xor_float_traits<double> {
+            using bits_type = uint64_t;
+            static constexpr unsigned bits = 64;
+            static constexpr unsigned field_bits = 6;
+        };
+
+    }
+
+    /**
+     * @brief 浮点序列的流式 XOR 编码器。
+     *
+     * Writer 需要提供 write(uint64_t v, unsigned width) 与 flush()，
+     * 例如 detail::bit_writer (写入缓冲区) 或 detail::bit_counter (只计算长度)。
+     * 每个值最多占用 max_bits_per_value 位，可据此预先分配缓冲区。
+     */
+    template <typename T, typename Writer>
+    class xor_encoder {
+        using traits = detail::xor_float_traits<T>;
+        using bits_type = typename traits::bits_type;
+
+    public:
+        static constexpr unsigned max_bits_per_value = 2 + 2 * traits::field_bits + traits::bits;
+
+        explicit xor_encoder(Writer& writer) : writer_(writer) {}
+
+        DMPACK_INLINE void push(T value) {
+            bits_type cur{};
+            std::memcpy(&cur, &value, sizeof(T));
+            if (first_) [[unlikely]] {
+                writer_.write(cur, traits::bits);
+                first_ = false;
+                prev_ = cur;
+                return;
+            }
+            uint64_t x = static_cast<uint64_t>(cur ^ prev_);
+            prev_ = cur;
+            if (x == 0) {
+                writer_.write(0, 1);
+                return;
+            }
+            unsigned lz = traits::bits - detail::bit_width_u64(x);
+            unsigned tz = detail::trailing_zeros_u64(x);
+            if (window_ && lz >= lz_ && tz >= tz_) {
+                writer_.write(0b01, 2);
+                writer_.write(x >> tz_, traits::bits - lz_ - tz_);
+                return;
+            }
+            unsigned len = traits::bits - lz - tz;
+            writer_.write(0b11, 2);
+            writer_.write(lz, traits::field_bits);
+            writer_.write(len - 1, traits::field_bits);
+            writer_.write(x >> tz, len);
+            window_ = true;
+            lz_ = lz;
+            tz_ = tz;
+        }
+
+        DMPACK_INLINE std::size_t finish() { return writer_.flush(); }
+
+    private:
+        Writer& writer_;
+        bits_type prev_{};
+        unsigned lz_{};
+        unsigned tz_{};
+        bool first_ = true;
+        bool window_ = false;
+    };
+
+    /**
+     * @brief 浮点序列的流式 XOR 解码器，与 xor_encoder 对应。
+     *
+     * 每次 next() 解出一个值；输入不足时 error() 返回 true。
+     */
+    template <typename T, typename Byte>
+    class xor_decoder {
+        using traits = detail::xor_float_traits<T>;
+        using bits_type = typename traits::bits_type;
+
+    public:
+        xor_decoder(const Byte* in, std::size_t size) : reader_(in, size) {}
+
+        DMPACK_INLINE T next() {
+            if (first_) [[unlikely]] {
+                prev_ = static_cast<bits_type>(reader_.read(traits::bits));
+                first_ = false;
+            }
+            else if (reader_.read(1)) {
+                if (reader_.read(1)) {
+                    lz_ = static_cast<unsigned>(reader_.read(traits::field_bits));
+                    unsigned len = static_cast<unsigned>(reader_.read(traits::field_bits)) + 1;
+                    if (lz_ + len > traits::bits) [[unlikely]] {
+                        error_ = true;
+                        return T{};
+                    }
+                    tz_ = traits::bits - lz_ - len;
+                }
+                else if (!window_) [[unlikely]] {
+                    error_ = true;
+                    return T{};
+                }
+                window_ = true;
+                uint64_t x = reader_.read(traits::bits - lz_ - tz_) << tz_;
+                prev_ ^= static_cast<bits_type>(x);
+            }
+            T value;
+            std::memcpy(&value, &prev_, sizeof(T));
+            return value;
+        }
+
+        DMPACK_INLINE bool error() const { return error_ || reader_.error(); }
+
+    private:
+        detail::bit_reader<Byte> reader_;
+        bits_type prev_{};
+        unsigned lz_{};
+        unsigned tz_{};
+        bool first_ = true;
+        bool window_ = false;
+        bool error_ = false;
+    };
+
+    namespace detail {
+
+        template <typename T>
+        std::size_t xor_encoded_size(const T* data, std::size_t count) {
+            bit_counter counter;
+            xor_encoder<T, bit_counter> enc(counter);
+            for (std::size_t i = 0; i < count; ++i) { enc.push(data[i]); }
+            return enc.finish();
+        }
+
+        template <typename T, typename Byte>
+        std::size_t xor_encode(const T* data, std::size_t count, Byte* out) {
+            bit_writer<Byte> writer(out);
+            xor_encoder<T, bit_writer<Byte>> enc(writer);
+            for (std::size_t i = 0; i < count; ++i) { enc.push(data[i]); }
+            return enc.finish();
+        }
+
+        template <typename T, typename Byte>
+        std::errc xor_decode(const Byte* in, std::size_t size, std::size_t count, T* out) {
+            xor_decoder<T, Byte> dec(in, size);
+            for (std::size_t i = 0; i < count; ++i) { out[i] = dec.next(); }
+            return dec.error() ? std::errc::invalid_argument : std::errc{};
+        }
+
+        // 检查 n 个字节是否都是合法的 bool (0 或 1)，按 64 位字做 SWAR 检查
+        template <typename Byte>
+        DMPACK_INLINE bool bool_bytes_valid(const Byte* p, std::size_t n) {
+            constexpr uint64_t low_bits = 0x0101010101010101ull;
+            uint64_t acc = 0;
+            std::size_t i = 0;
+            for (; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t)) {
+                uint64_t word;
+                std::memcpy(&word, p + i, sizeof(uint64_t));
+                acc |= word;
+            }
+            if (i < n) { acc |= load_u64_partial(p + i, n - i); }
+            return (acc & ~low_bits) == 0;
+        }
+
+        //-----------------------------------------------------------------------------
+        // 位数组编解码: 第 i 位存放在第 i / 8 个字节的第 i % 8 位，末尾不足一字节的部分补 0
+        //
+        // 对象的底层存储与这一格式相同 (低位在前的字数组、小端机器) 时直接按字节整块拷贝:
+        //   std::bitset<N>   : N <= 64 时经 to_ullong 整字读写；更长时探测对象表示后整块拷贝，
+        //                      探测不符时按 64 位切片移位 (N <= bits_slice_limit)，再长则逐位
+        //   std::vector<bool>: 仅 libstdc++ 可取得底层字数组，探测相符时整块拷贝；
+        //                      libc++、MSVC 等其它标准库逐位经 operator[] 读写，
+        //                      每位一次代理对象访问，百万位约慢两到三个数量级
+        // 其它只支持 operator[] 的类型逐位读写
+        //-----------------------------------------------------------------------------
+        DMPACK_INLINE constexpr std::size_t bits_encoded_size(std::size_t count) { return (count + 7) / 8; }
+
+        // 超过这个长度时逐个切片移位的代价 (与字数的平方成正比) 高于逐位读写
+        inline constexpr std::size_t bits_slice_limit = 1024;
+
+        template <typename Bits, typename Byte>
+        void bits_encode_each(const Bits& bits, std::size_t count, Byte* out) {
+            for (std::size_t i = 0; i < count; i += 64) {
+                std::size_t n = count - i < 64 ? count - i : 64;
+                uint64_t word = 0;
+                for (unsigned j = 0; j < n; ++j) { word |= static_cast<uint64_t>(bool(bits[i + j])) << j; }
+                std::memcpy(out + i / 8, &word, bits_encoded_size(n));
+            }
+        }
+
+        // bits 的前 count 位必须已全部清零，只按字遍历置位的比特
+        template <typename Bits, typename Byte>
+        void bits_decode_each(const Byte* in, std::size_t count, Bits& bits) {
+            for (std::size_t i = 0; i < count; i += 64) {
+                std::size_t n = count - i < 64 ? count - i : 64;
+                uint64_t word = load_u64_partial(in + i / 8, bits_encoded_size(n));
+                if (n < 64) { word &= (uint64_t{ 1 } << n) - 1; }
+                while (word) {
+                    bits[i + trailing_zeros_u64(word)] = true;
+                    word &= word - 1;
+                }
+            }
+        }
+
+        template <typename Bits, typename Byte>
+        void bits_encode(const Bits& bits, std::size_t count, Byte* out) {
+            bits_encode_each(bits, count, out);
+        }
+
+        template <typename Bits, typename Byte>
+        void bits_decode(const Byte* in, std::size_t count, Bits& bits) {
+            bits_decode_each(in, count, bits);
+        }
+
+        // 整块拷贝: 存储的最后一个字节中超出 count 的位内容不确定，写出时清零
+        template <typename Byte>
+        void bits_copy_out(const unsigned char* storage, std::size_t count, Byte* out) {
+            std::size_t full = count / 8;
+            if (full) { std::memcpy(out, storage, full); }
+            if (count % 8 != 0) {
+                out[full] = static_cast<Byte>(storage[full] & ((1u << (count % 8)) - 1));
+            }
+        }
+
+        // 只覆盖前 count 位，同一字节中超出 count 的位保持原样
+        template <typename Byte>
+        void bits_copy_in(const Byte* in, std::size_t count, unsigned char* storage) {
+            std::size_t full = count / 8;
+            if (full) { std::memcpy(storage, in, full); }
+            if (count % 8 != 0) {
+                unsigned mask = (1u << (count % 8)) - 1;
+                storage[full] = static_cast<unsigned char>((storage[full] & ~mask) | (static_cast<unsigned char>(in[full]) & mask));
+            }
+        }
+
+        // 只置位 bit 时，size 个字节的对象表示是否恰好在第 bit / 8 个字节的第 bit % 8 位为 1
+        inline bool bits_probe_matches(const unsigned char* bytes, std::size_t size, std::size_t bit) {
+            for (std::size_t k = 0; k < size; ++k) {
+                unsigned expected = k == bit / 8 ? (1u << (bit % 8)) : 0u;
+                if (bytes[k] != expected) { return false; }
+            }
+            return true;
+        }
+
+        // bitset<N> 的对象表示是否与线上格式相同，逐个探测字内、跨字与末尾的位置，结果缓存
+        template <std::size_t N>
+        bool bitset_storage_matches() {
+            static const bool matches = [] {
+                for (std::size_t bit : { std::size_t{ 0 }, std::size_t{ 9 }, std::size_t{ 31 }, std::size_t{ 32 },
+                         std::size_t{ 63 }, std::size_t{ 64 }, N - 1 }) {
+                    if (bit >= N) { continue; }
+                    // N 可能很大，探测对象放在堆上
+                    auto probe = std::make_unique<std::bitset<N>>();
+                    probe->set(bit);
+                    if (!bits_probe_matches(reinterpret_cast<const unsigned char*>(probe.get()), sizeof(*probe), bit)) { return false; }
+                }
+                return true;
+            }();
+            return matches;
+        }
+
+        template <std::size_t N>
+        inline constexpr bool bitset_storage_copyable_v =
+            std::is_trivially_copyable_v<std::bitset<N>> && sizeof(std::bitset<N>) >= (N + 7) / 8;
+
+        template <std::size_t N, typename Byte>
+        void bits_encode(const std::bitset<N>& bits, std::size_t count, Byte* out) {
+            if constexpr (N <= 64) {
+                uint64_t word = bits.to_ullong();
+                std::memcpy(out, &word, bits_encoded_size(N));
+                return;
+            }
+            else {
+                if constexpr (bitset_storage_copyable_v<N>) {
+                    if (bitset_storage_matches<N>()) {
+                        bits_copy_out(reinterpret_cast<const unsigned char*>(&bits), N, out);
+                        return;
+                    }
+                }
+                if constexpr (N <= bits_slice_limit) {
+                    const std::bitset<N> low_word(~uint64_t{ 0 });
+                    std::bitset<N> rest = bits;
+                    for (std::size_t i = 0; i < N; i += 64) {
+                        uint64_t word = (rest & low_word).to_ullong();
+                        std::memcpy(out + i / 8, &word, bits_encoded_size(N - i < 64 ? N - i : 64));
+                        rest >>= 64;
+                    }
+                }
+                else { bits_encode_each(bits, count, out); }
+            }
+        }
+
+        template <std::size_t N, typename Byte>
+        void bits_decode(const Byte* in, std::size_t count, std::bitset<N>& bits) {
+            if constexpr (bitset_storage_copyable_v<N> && N > 64) {
+                if (bitset_storage_matches<N>()) {
+                    bits_copy_in(in, N, reinterpret_cast<unsigned char*>(&bits));
+                    return;
+                }
+            }
+            if constexpr (N <= bits_slice_limit) {
+                // 从最高的切片开始，逐片左移拼入
+                std::bitset<N> value;
+                for (std::size_t slice = (N + 63) / 64; slice-- > 0;) {
+                    std::size_t i = slice * 64;
+                    std::size_t n = N - i < 64 ? N - i : 64;
+                    uint64_t word = load_u64_partial(in + i / 8, bits_encoded_size(n));
+                    if constexpr (N > 64) { value <<= 64; }
+                    value |= std::bitset<N>(word);
+                }
+                bits = value;
+            }
+            else { bits_decode_each(in, count, bits); }
+        }
+
+#if DMPACK_BOOL_VECTOR_STORAGE
+        static_assert(std::is_unsigned_v<std::_Bit_type> && std::_S_word_bit == sizeof(std::_Bit_type) * CHAR_BIT,
+            "unexpected libstdc++ vector<bool> storage");
+
+        // 底层字数组的字节序列是否与线上格式相同 (低位在前且为小端)，结果缓存
+        inline bool bool_vector_storage_matches() {
+            static const bool matches = [] {
+                constexpr std::size_t word_bits = std::_S_word_bit;
+                for (std::size_t bit : { std::size_t{ 0 }, std::size_t{ 9 }, word_bits - 1, word_bits + 3 }) {
+                    std::vector<bool> probe(2 * word_bits, false);
+                    probe[bit] = true;
+                    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(probe.begin()._M_p);
+                    if (!bits_probe_matches(bytes, 2 * sizeof(std::_Bit_type), bit)) { return false; }
+                }
+                return true;
+            }();
+            return matches;
+        }
+
+        template <typename Alloc, typename Byte>
+        void bits_encode(const std::vector<bool, Alloc>& bits, std::size_t count, Byte* out) {
+            if (count == 0) { return; }
+            if (!bool_vector_storage_matches()) { return bits_encode_each(bits, count, out); }
+            bits_copy_out(reinterpret_cast<const unsigned char*>(bits.begin()._M_p), count, out);
+        }
+
+        template <typename Alloc, typename Byte>
+        void bits_decode(const Byte* in, std::size_t count, std::vector<bool, Alloc>& bits) {
+            if (count == 0) { return; }
+            if (!bool_vector_storage_matches()) { return bits_decode_each(in, count, bits); }
+            bits_copy_in(in, count, reinterpret_cast<unsigned char*>(bits.begin()._M_p));
+        }
+#endif
+    }
+}
+
+#endif // __DMTYPETRAITS_PACK_CODEC_H_INCLUDE__
@@ -0,0 +1,282 @@
+#ifndef __DMTYPETRAITS_PACK_CURSOR_H_INCLUDE__
+#define __DMTYPETRAITS_PACK_CURSOR_H_INCLUDE__
+
+#include "dmtypetraits_pack.h"
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+namespace dm::pack {
+
+    class pack_cursor;
+
+    namespace detail {
+
+        //-----------------------------------------------------------------------------
+        // 可分段的序列化
+        //
+        // 对象按 serialize_one 的顺序展开成一个显式的帧栈: 每个字符串、容器、结构体等占一帧，
+        // 帧的 advance 每次只产出一段输出 (长度头、标记或一段原始内存) 或压入一个子帧。
+        // 原始内存 (字符串、平凡可拷贝元素的 vector、整块存放的结构体) 直接从对象上拷贝，
+        // 可以在任意字节处断开；delta/xor/vector<bool>/bitset 先整体编码到暂存区再分段输出。
+        //-----------------------------------------------------------------------------
+        struct cursor_frame {
+            const void* object;
+            bool (*advance)(pack_cursor& cursor, std::size_t self);   // 返回 false 表示本帧已结束
+            std::size_t index;
+            alignas(std::max_align_t) unsigned char iter[4 * sizeof(void*)];   // 节点式容器的迭代器
+        };
+
+        template <typename U>
+        bool cursor_advance(pack_cursor& cursor, std::size_t self);
+
+    } // namespace detail
+
+    /**
+     * @brief 可分段执行的序列化器，每次 step 最多输出 budget 个字节，下次从断开处继续。
+     *
+     * 所有 step 输出拼接后与 serialize(args...) 的结果逐字节相同，适合把大对象的存盘分摊到多帧里执行。
+     * 序列化期间各对象必须保持存活且不被修改。用法:
+     *   dm::pack::pack_cursor c(obj);
+     *   while (!c.done()) { out.write(buf, c.step(buf, sizeof(buf))); }
+     */
+    class pack_cursor {
+    public:
+        template <typename... Args>
+        explicit pack_cursor(const Args&... args) {
+            static_assert(sizeof...(args) > 0);
+            frames_.reserve(16);
+            uint32_t types_code = static_cast<uint32_t>(get_type_code<Args...>());
+            if constexpr ((detail::unexist_compatible_member_v<Args> && ...)) { emit_value(types_code); }
+            else {
+                uint64_t size = get_needed_size(args...);
+                scratch_.resize(sizeof(uint32_t) + sizeof(uint64_t));
+                std::memcpy(scratch_.data(), &types_code, sizeof(uint32_t));
+                std::memcpy(scratch_.data() + sizeof(uint32_t), &size, sizeof(uint64_t));
+                emit(scratch_.data(), scratch_.size());
+            }
+            // 帧栈后进先出，按参数逆序压入
+            (push(args), ...);
+            std::reverse(frames_.begin(), frames_.end());
+        }
+
+        pack_cursor(const pack_cursor&) = delete;
+        pack_cursor& operator=(const pack_cursor&) = delete;
+
+        /**
+         * @brief 向 out 写出至多 budget 个字节，返回实际写出的字节数；全部写完后 done() 为 true。
+         */
+        template <typename Byte, typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
+        std::size_t step(Byte* out, std::size_t budget) {
+            detail::ref_context* saved = detail::current_refs;
+            detail::current_refs = &refs_;
+            std::size_t written = 0;
+            for (;;) {
+                while (piece_len_ == 0 && !frames_.empty()) {
+                    std::size_t top = frames_.size() - 1;
+                    if (!frames_[top].advance(*this, top)) { frames_.pop_back(); }
+                }
+                if (piece_len_ == 0 || written == budget) { break; }
+                std::size_t n = (std::min)(piece_len_, budget - written);
+                std::memcpy(out + written, piece_, n);
+                piece_ += n;
+                piece_len_ -= n;
+                written += n;
+            }
+            detail::current_refs = saved;
+            return written;
+        }
+
+        bool done() const { return piece_len_ == 0 && frames_.empty(); }
+
+    private:
+        template <typename U>
+        friend bool detail::cursor_advance(pack_cursor& cursor, std::size_t self);
+
+        template <typename U>
+        void push(const U& obj) {
+            frames_.push_back({ &obj, &detail::cursor_advance<U>, 0, {} });
+        }
+
+        void emit(const void* data, std::size_t size) {
+            piece_ = static_cast<const char*>(data);
+            piece_len_ = size;
+        }
+
+        template <typename V>
+        void emit_value(const V& value) {
+            scratch_.resize(sizeof(V));
+            std::memcpy(scratch_.data(), &value, sizeof(V));
+            emit(scratch_.data(), sizeof(V));
+        }
+
+        // 整体编码到暂存区
+        template <typename U>
+        void emit_packed(const U& obj) {
+            scratch_.resize(detail::compact_thunks<U>::measure(&obj));
+            emit(scratch_.data(), detail::compact_thunks<U>::pack(&obj, scratch_.data()));
+        }
+
+        std::vector<detail::cursor_frame> frames_;
+        std::vector<char> scratch_;
+        const char* piece_ = nullptr;                        // 尚未输出的一段
+        std::size_t piece_len_ = 0;
+        detail::ref_context refs_;
+    };
+
+    namespace detail {
+
+        // 与 packer::serialize_one 的分支一一对应，产出的字节序列相同
+        template <typename U>
+        bool cursor_advance(pack_cursor& cursor, std::size_t self) {
+            using type = dm_remove_cvref_t<U>;
+            cursor_frame& frame = cursor.frames_[self];
+            const type& item = *static_cast<const type*>(frame.object);
+            std::size_t step = frame.index++;
+            // 压入子帧会使 frame 失效，push 之后不再访问它
+            if constexpr (dm_is_monostate_v<type>) { return false; }
+            else if constexpr (dm_is_fundamental_v<type> || dm_is_enum_v<type>) {
+                if (step > 0) { return false; }
+                cursor.emit(&item, sizeof(type));
+            }
+            else if constexpr (dm_pack_is_bounded_v<type>) {
+                if (step > 0) { return false; }
+                if (item.size() > type::max_length) [[unlikely]] { exit_bounded_size(type::max_length); }
+                cursor.push(static_cast<const typename type::base&>(item));
+            }
+            else if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) {
+                if constexpr (dm_pack_raw_v<type>) {
+                    if (step > 0) { return false; }
+                    cursor.emit(&item, sizeof(type));
+                }
+                else {
+                    if (step >= dm_get_array_size_v<type>) { return false; }
+                    cursor.push(item[step]);
+                }
+            }
+            else if constexpr (dm_pack_is_delta_vector_v<type> || dm_pack_is_xor_vector_v<type> ||
+                dm_pack_is_bool_vector_v<type> || dm_pack_is_bitset_v<type>) {
+                if (step > 0) { return false; }
+                cursor.emit_packed(item);
+            }
+            else if constexpr (dm_pack_is_shared_ptr_v<type>) {
+                if (step == 0) {
+                    uint32_t tag = item ? ref_encode(item.get(), ref_type_of<typename type::element_type>()) : ref_null;
+                    // 只有内联写出的对象需要进入下一步
+                    if (tag != ref_inline) { frame.index = 2; }
+                    cursor.emit_value(tag);
+                }
+                else if (step == 1) { cursor.push(*item); }
+                else { return false; }
+            }
+            else if constexpr (dm_pack_is_flat_table_v<type>) {
+                // 第 0 步写行数，之后每行两步: 长度、元素
+                if (step == 0) {
+                    if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    cursor.emit_value(static_cast<size_type>(item.size()));
+                }
+                else {
+                    std::size_t row = (step - 1) / 2;
+                    if (row >= item.size()) { return false; }
+                    auto r = item[row];
+                    if ((step - 1) % 2 == 0) {
+                        if (r.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                        cursor.emit_value(static_cast<size_type>(r.size()));
+                    }
+                    else { cursor.emit(r.data(), r.size() * sizeof(typename type::element_type)); }
+                }
+            }
+            else if constexpr (dm_pack_is_split_v<type>) {
+                // 第 0 步写行数; 整块拷贝的 T 每步经暂存区写一行，其余每步压入一个成员
+                using value_type = typename type::value_type;
+                if (step == 0) {
+                    if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    cursor.emit_value(static_cast<size_type>(item.size()));
+                }
+                else if constexpr (dm_pack_raw_v<value_type>) {
+                    if (step - 1 >= item.size()) { return false; }
+                    cursor.emit_packed(item.load(step - 1));
+                }
+                else {
+                    constexpr std::size_t members = std::tuple_size_v<decltype(get_types(std::declval<value_type>()))>;
+                    std::size_t row = (step - 1) / members;
+                    if (row >= item.size()) { return false; }
+                    std::size_t index = (step - 1) % members;
+                    item.visit(row, [&](const auto&... member) {
+                        std::size_t i = 0;
+                        ((i++ == index ? cursor.push(member) : void()), ...);
+                    });
+                }
+            }
+            else if constexpr (dm_pack_is_unique_ptr_v<type> || dm_is_optional_v<type>) {
+                bool has_value = static_cast<bool>(item);
+                if (step == 0) { cursor.emit_value(static_cast<char>(has_value)); }
+                else if (step == 1 && has_value) { cursor.push(*item); }
+                else { return false; }
+            }
+            else if constexpr (dm_is_map_container_v<type> || dm_is_container_v<type>) {
+                if (step == 0) {
+                    if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    cursor.emit_value(static_cast<size_type>(item.size()));
+                    if constexpr (!dm_pack_raw_container_v<type>) {
+                        using iterator = typename type::const_iterator;
+                        static_assert(sizeof(iterator) <= sizeof(frame.iter) && std::is_trivially_destructible_v<iterator>);
+                        new (frame.iter) iterator(item.begin());
+                    }
+                }
+                else if constexpr (dm_pack_raw_container_v<type>) {
+                    if (step > 1 || item.empty()) { return false; }
+                    cursor.emit(item.data(), item.size() * sizeof(typename type::value_type));
+                }
+                else {
+                    using iterator = typename type::const_iterator;
+                    iterator& it = *std::launder(reinterpret_cast<iterator*>(frame.iter));
+                    if (it == item.end()) { return false; }
+                    const auto& element = *it;
+                    ++it;
+                    cursor.push(element);
+                }
+            }
+            else if constexpr (dm_is_tuple_like_v<type>) {
+                using types = decltype(get_types(std::declval<type>()));
+                if (step >= std::tuple_size_v<types>) { return false; }
+                visit_member_at(item, static_cast<int>(step), [&](const auto& member) { cursor.push(member); return std::errc{}; });
+            }
+            else if constexpr (dm_is_variant_v<type>) {
+                if (step == 0) {
+                    if (item.index() == std::variant_npos) [[unlikely]] { exit_valueless_variant(); }
+                    cursor.emit_value(static_cast<uint32_t>(item.index()));
+                }
+                else if (step == 1) { std::visit([&](const auto& e) { cursor.push(e); }, item); }
+                else { return false; }
+            }
+            else if constexpr (dm_pack_expected_v<type>) {
+                bool has_value = item.has_value();
+                if (step == 0) { cursor.emit_value(has_value); }
+                else if (step > 1) { return false; }
+                else if (!has_value) { cursor.push(item.error()); }
+                else if constexpr (!dm_is_void_v<typename type::value_type>) { cursor.push(item.value()); }
+                else { return false; }
+            }
+            else if constexpr (dm_is_class_v<type>) {
+                static_assert(dm_is_aggregate_v<type>);
+                if constexpr (dm_pack_raw_v<type>) {
+                    if (step > 0) { return false; }
+                    cursor.emit(&item, sizeof(type));
+                }
+                else {
+                    using types = decltype(get_types(std::declval<type>()));
+                    if (step >= std::tuple_size_v<types>) { return false; }
+                    visit_member_at(item, static_cast<int>(step), [&](const auto& member) { cursor.push(member); return std::errc{}; });
+                }
+            }
+            else { static_assert(!sizeof(type), "the type is not supported yet"); }
+            return true;
+        }
+
+    } // namespace detail
+
+} // namespace dm::pack
+
+#endif // __DMTYPETRAITS_PACK_CURSOR_H_INCLUDE__
@@ -3,17 +3,25 @@
 
 #include "dmtypetraits_reflection.h"
 #include "dmtypetraits_md5.h"
+#include "dmtypetraits_pack_codec.h"
 
+#include <algorithm>
+#include <array>
+#include <bitset>
 #include <climits>
 #include <cstring>
 #include <iostream>
 #include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <system_error>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -26,6 +34,10 @@
 #warning "Compiler not checked for endianness, assuming little endian."
 #endif
 
+namespace dm {
+    template <typename T, std::size_t... Hot>
+    class split;
+}
 
 namespace dm::pack {
 
@@ -40,13 +52,105 @@ namespace dm::pack {
     constexpr uint32_t MAX_SIZE = UINT32_MAX;
 #endif
 
+#ifndef DMPACK_MAX_DEPTH
+#define DMPACK_MAX_DEPTH 64
+#endif
+
+    /**
+     * @brief 为枚举类型声明合法取值范围 [min, max]，validate 会据此检查线上的枚举值。
+     *
+     * 未特化的枚举不做范围检查。用法:
+     *   template <> struct dm::pack::enum_range<Color> {
+     *       static constexpr Color min = Color::red;
+     *       static constexpr Color max = Color::blue;
+     *   };
+     */
+    template <typename E>
+    struct enum_range;
+
     template <typename T>
     struct compatible;
     template <typename T>
     struct deserialize_result;
+    template <typename T>
+    struct delta_vector;
+    template <typename T>
+    struct xor_vector;
+    template <typename Container, std::size_t N>
+    struct bounded;
+    struct compact_codec;
+    struct packed_codec;
+    template <typename T>
+    class jagged;
+    class string_table;
 
     namespace detail {
 
+        namespace dm_detail {
+            template <typename T> struct is_delta_vector : std::false_type {};
+            template <typename T> struct is_delta_vector<delta_vector<T>> : std::true_type {};
+            template <typename T> struct is_xor_vector : std::false_type {};
+            template <typename T> struct is_xor_vector<xor_vector<T>> : std::true_type {};
+            template <typename T> struct is_bool_vector : std::false_type {};
+            template <typename Alloc> struct is_bool_vector<std::vector<bool, Alloc>> : std::true_type {};
+            template <typename T> struct is_bitset : std::false_type {};
+            template <std::size_t N> struct is_bitset<std::bitset<N>> : std::true_type {};
+            template <typename T> struct is_bounded : std::false_type {};
+            template <typename Container, std::size_t N> struct is_bounded<bounded<Container, N>> : std::true_type {};
+            template <typename T> struct is_shared_ptr : std::false_type {};
+            // 指向数组的智能指针不记录长度，不支持
+            template <typename T> struct is_shared_ptr<std::shared_ptr<T>> : std::bool_constant<!std::is_array_v<T>> {};
+            template <typename T> struct is_unique_ptr : std::false_type {};
+            template <typename T> struct is_unique_ptr<std::unique_ptr<T, std::default_delete<T>>> : std::bool_constant<!std::is_array_v<T>> {};
+            template <typename T> struct is_flat_table : std::false_type {};
+            template <typename T> struct is_flat_table<jagged<T>> : std::true_type {};
+            template <> struct is_flat_table<string_table> : std::true_type {};
+            template <typename T> struct is_split : std::false_type {};
+            template <typename T, std::size_t... Hot> struct is_split<split<T, Hot...>> : std::true_type {};
+            template <typename T, typename = void> struct has_enum_range : std::false_type {};
+            template <typename T> struct has_enum_range<T, std::void_t<decltype(enum_range<T>::min), decltype(enum_range<T>::max)>> : std::true_type {};
+            template <typename T, typename = void> struct has_compact_codec : std::false_type {};
+            template <typename T> struct has_compact_codec<T, std::void_t<typename T::codec_t>> : std::is_same<typename T::codec_t, compact_codec> {};
+            template <typename T, typename = void> struct has_packed_codec : std::false_type {};
+            template <typename T> struct has_packed_codec<T, std::void_t<typename T::codec_t>> : std::is_same<typename T::codec_t, packed_codec> {};
+        }
+
+        template <typename T>
+        inline constexpr bool dm_pack_is_delta_vector_v = dm_detail::is_delta_vector<dm_remove_cvref_t<T>>::value;
+
+        template <typename T>
+        inline constexpr bool dm_pack_is_xor_vector_v = dm_detail::is_xor_vector<dm_remove_cvref_t<T>>::value;
+
+        template <typename T>
+        inline constexpr bool dm_pack_is_bool_vector_v = dm_detail::is_bool_vector<dm_remove_cvref_t<T>>::value;
+
+        template <typename T>
+        inline constexpr bool dm_pack_is_bitset_v = dm_detail::is_bitset<dm_remove_cvref_t<T>>::value;
+
+        template <typename T>
+        inline constexpr bool dm_pack_is_bounded_v = dm_detail::is_bounded<dm_remove_cvref_t<T>>::value;
+
+        template <typename T>
+        inline constexpr bool dm_pack_is_shared_ptr_v = dm_detail::is_shared_ptr<dm_remove_cvref_t<T>>::value;
+
+        template <typename T>
+        inline constexpr bool dm_pack_is_unique_ptr_v = dm_detail::is_unique_ptr<dm_remove_cvref_t<T>>::value;
+
+        template <typename T>
+        inline constexpr bool dm_pack_is_flat_table_v = dm_detail::is_flat_table<dm_remove_cvref_t<T>>::value;
+
+        // dm::split: 线上与 std::vector<T> 相同，按行经 visit 读写成员
+        template <typename T>
+        inline constexpr bool dm_pack_is_split_v = dm_detail::is_split<dm_remove_cvref_t<T>>::value;
+
+        template <typename T>
+        inline constexpr bool dm_pack_has_enum_range_v = dm_detail::has_enum_range<dm_remove_cvref_t<T>>::value;
+
+        // 选择了表驱动编解码的结构体；平凡可拷贝的结构体本来就是整块 memcpy，不需要成员表
+        template <typename T>
+        inline constexpr bool dm_pack_use_compact_v = dm_detail::has_compact_codec<dm_remove_cvref_t<T>>::value &&
+            dm_is_aggregate_v<dm_remove_cvref_t<T>> && !dm_is_trivially_copyable_v<dm_remove_cvref_t<T>> && !dm_is_tuple_like_v<dm_remove_cvref_t<T>>;
+
         template <typename T>
         inline constexpr bool dm_pack_byte_v = dm_is_same_v<char, T> || dm_is_same_v<unsigned char, T> || dm_is_same_v<std::byte, T>;
 
@@ -68,7 +172,8 @@ namespace dm::pack {
             if constexpr (dm_is_fundamental_v<T> || dm_is_enum_v<T> || dm_pack_is_std_basic_string_v<T> ||
                 (dm_is_container_v<T> && !dm_pack_is_std_basic_string_v<T>) ||
                 dm_is_optional_v<T> || dm_is_variant_v<T> || dm_pack_expected_v<T> ||
-                dm_is_std_array_v<T> || dm_is_c_array_v<T> || dm_is_monostate_v<T>) {
+                dm_is_std_array_v<T> || dm_is_c_array_v<T> || dm_is_monostate_v<T> || dm_pack_is_bitset_v<T> ||
+                dm_pack_is_shared_ptr_v<T> || dm_pack_is_unique_ptr_v<T>) {
                 return std::tuple<T>{};
             }
             else if constexpr (dm_is_tuple_v<T>) {
@@ -85,14 +190,78 @@ namespace dm::pack {
             }
         }
 
+        template <typename T>
+        constexpr bool pack_contains_stripped();
+
+        template <typename Tuple, std::size_t... I>
+        constexpr bool pack_any_stripped(std::index_sequence<I...>) {
+            return (false || ... || pack_contains_stripped<std::tuple_element_t<I, Tuple>>());
+        }
+
+        template <typename Variant, std::size_t... I>
+        constexpr bool pack_any_alternative_stripped(std::index_sequence<I...>) {
+            return (false || ... || pack_contains_stripped<std::variant_alternative_t<I, Variant>>());
+        }
+
+        template <typename Tuple, std::size_t... I>
+        constexpr std::size_t pack_members_size(std::index_sequence<I...>) {
+            return (std::size_t{ 0 } + ... + sizeof(std::tuple_element_t<I, Tuple>));
+        }
+
+        // 声明了 packed_codec 的平凡可拷贝结构体，成员之间或末尾有填充 (或某个成员本身去除了填充) 时逐成员写出;
+        // 没有填充时逐成员写出与整块 memcpy 结果相同，仍走整块拷贝
+        template <typename T>
+        constexpr bool pack_strips_padding() {
+            using type = dm_remove_cvref_t<T>;
+            if constexpr (dm_detail::has_packed_codec<type>::value && dm_is_class_v<type> && dm_is_aggregate_v<type> &&
+                dm_is_trivially_copyable_v<type> && !dm_is_tuple_like_v<type>) {
+                using types = decltype(get_types(std::declval<type>()));
+                constexpr auto seq = dm_make_index_sequence<std::tuple_size_v<types>>();
+                return pack_members_size<types>(seq) != sizeof(type) || pack_any_stripped<types>(seq);
+            }
+            else { return false; }
+        }
+
+        // 平凡可拷贝的类型内部是否有需要去除填充的结构体，与 serialize_one 中整块 memcpy 的各个分支对应
+        template <typename T>
+        constexpr bool pack_contains_stripped() {
+            using type = dm_remove_cvref_t<T>;
+            if constexpr (!dm_is_trivially_copyable_v<type>) { return false; }
+            else if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) { return pack_contains_stripped<dm_element_type_t<type>>(); }
+            else if constexpr (dm_is_optional_v<type>) { return pack_contains_stripped<typename type::value_type>(); }
+            else if constexpr (dm_is_variant_v<type>) {
+                return pack_any_alternative_stripped<type>(dm_make_index_sequence<std::variant_size_v<type>>());
+            }
+            else if constexpr (dm_is_class_v<type> && dm_is_aggregate_v<type> && !dm_is_tuple_like_v<type> &&
+                !dm_pack_is_bitset_v<type> && !dm_is_monostate_v<type>) {
+                using types = decltype(get_types(std::declval<type>()));
+                return pack_strips_padding<type>() || pack_any_stripped<types>(dm_make_index_sequence<std::tuple_size_v<types>>());
+            }
+            else { return false; }
+        }
+
+        // 可以整块 memcpy 的类型: 平凡可拷贝，且内部没有去除填充的结构体
+        template <typename T>
+        inline constexpr bool dm_pack_raw_v = dm_is_trivially_copyable_v<dm_remove_cvref_t<T>> && !pack_contains_stripped<T>();
+
+        template <typename T>
+        inline constexpr bool dm_pack_raw_container_v = dm_pack_trivially_copyable_container_v<T> && dm_pack_raw_v<dm_element_type_t<T>>;
+
+        // 单个顶层参数的类型表，类型码由它生成: 结构体展开为成员，
+        // 去除了填充的结构体保留自身，使类型码带上 packed_class_t，与整块存放时不同
+        template <typename T>
+        using top_level_types_t = std::conditional_t<pack_strips_padding<T>(),
+            std::tuple<dm_remove_cvref_t<T>>, decltype(get_types(std::declval<T>()))>;
+
         enum class type_id {
             compatible_t = 0,
             int32_t = 1, uint32_t, int64_t, uint64_t, int8_t, uint8_t, int16_t, uint16_t,
             int128_t, uint128_t, bool_t, char_8_t, char_16_t, char_32_t, w_char_t,
             float16_t, float32_t, float64_t, float128_t,
             string_t = 128, array_t, map_container_t, set_container_t, container_t,
-            optional_t, variant_t, expected_t,
-            monostate_t = 253, aggregate_class_t = 254, type_end_flag = 255,
+            optional_t, variant_t, expected_t, delta_container_t, xor_container_t,
+            bit_container_t, bitset_t, shared_ptr_t, unique_ptr_t, enclosing_t,
+            packed_class_t = 252, monostate_t = 253, aggregate_class_t = 254, type_end_flag = 255,
         };
 
         //
@@ -160,6 +329,12 @@ namespace dm::pack {
             else if constexpr (dm_is_integral_v<U>) { return get_integral_type<U>(); }
             else if constexpr (dm_is_floating_point_v<U>) { return get_floating_point_type<U>(); }
             else if constexpr (dm_is_monostate_v<U> || dm_is_void_v<U>) { return type_id::monostate_t; }
+            else if constexpr (dm_pack_is_delta_vector_v<U>) { return type_id::delta_container_t; }
+            else if constexpr (dm_pack_is_xor_vector_v<U>) { return type_id::xor_container_t; }
+            else if constexpr (dm_pack_is_bool_vector_v<U>) { return type_id::bit_container_t; }
+            else if constexpr (dm_pack_is_bitset_v<U>) { return type_id::bitset_t; }
+            else if constexpr (dm_pack_is_shared_ptr_v<U>) { return type_id::shared_ptr_t; }
+            else if constexpr (dm_pack_is_unique_ptr_v<U>) { return type_id::unique_ptr_t; }
             else if constexpr (dm_pack_string_v<U>) { return type_id::string_t; }
             else if constexpr (dm_is_any_array_v<U>) { return type_id::array_t; }
             else if constexpr (dm_is_map_container_v<U>) { return type_id::map_container_t; }
@@ -175,6 +350,8 @@ namespace dm::pack {
             else if constexpr (dm_is_tuple_like_v<U>) { return type_id::aggregate_class_t; }
             else if constexpr (dm_is_class_v<U>) {
                 static_assert(dm_is_aggregate_v<U>);
+                // 去除了填充的结构体线上布局不同，使用单独的标识以免与整块存放的旧数据混淆
+                if constexpr (pack_strips_padding<U>()) { return type_id::packed_class_t; }
                 return type_id::aggregate_class_t;
             }
             else { static_assert(!sizeof(T), "not supported type"); }
@@ -186,13 +363,24 @@ namespace dm::pack {
             return string_literal<char, 8>{{(char)(size >> 56), (char)((size >> 48) % 256), (char)((size >> 40) % 256), (char)((size >> 32) % 256), (char)((size >> 24) % 256), (char)((size >> 16) % 256), (char)((size >> 8) % 256), (char)(size % 256)}};
         }
 
-        template <typename Args, typename ParentArg, std::size_t... I>
+        template <typename Args, typename ParentArg, typename Enclosing, std::size_t... I>
         constexpr decltype(auto) get_type_literal_impl(std::index_sequence<I...>);
 
-        template <typename Args, std::size_t... I>
+        template <typename Args, typename Enclosing, std::size_t... I>
         constexpr decltype(auto) get_variant_literal_impl(std::index_sequence<I...>);
 
-        template <typename Arg, typename ParentArg>
+        // T 在正在展开的外层结构体中的层数 (最内层为 1)，不在其中时为 0
+        template <typename T, typename Enclosing>
+        struct enclosing_depth : std::integral_constant<std::size_t, 0> {};
+
+        template <typename T, typename Outer, typename... Rest>
+        struct enclosing_depth<T, std::tuple<Outer, Rest...>>
+            : std::integral_constant<std::size_t, dm_is_same_v<T, Outer> ? 1 :
+                (enclosing_depth<T, std::tuple<Rest...>>::value ? enclosing_depth<T, std::tuple<Rest...>>::value + 1 : 0)> {};
+
+        // Enclosing 为正在展开的外层结构体 (由内到外)。智能指针指回其中之一时不再展开，
+        // 写出 enclosing_t 与层数，递归类型 (如持有子节点指针的树节点) 因此得到有限的描述串
+        template <typename Arg, typename ParentArg, typename Enclosing = std::tuple<>>
         constexpr decltype(auto) get_type_literal() {
             constexpr auto id = get_type_id<Arg>();
             constexpr auto ret = string_literal<char, 1>{ {static_cast<char>(id)} };
@@ -204,9 +392,10 @@ namespace dm::pack {
                     static_assert(dm_is_void_v<ParentArg> || dm_is_variant_v<ParentArg>, "monostate/void only allowed in variant or as expected's value_type");
                 }
             }
-            if constexpr (id == type_id::aggregate_class_t) {
+            if constexpr (id == type_id::aggregate_class_t || id == type_id::packed_class_t) {
                 using Args = decltype(get_types(Arg{}));
-                constexpr auto body = get_type_literal_impl<Args, Arg>(dm_make_index_sequence<std::tuple_size_v<Args>>());
+                using Inner = decltype(std::tuple_cat(std::declval<std::tuple<Arg>>(), std::declval<Enclosing>()));
+                constexpr auto body = get_type_literal_impl<Args, Arg, Inner>(dm_make_index_sequence<std::tuple_size_v<Args>>());
                 //
                 // --- BEGIN: 已应用的修复 ---
                 //
@@ -220,7 +409,7 @@ namespace dm::pack {
                 constexpr auto sz = std::variant_size_v<Arg>;
                 static_assert(sz > 0, "empty param of std::variant is not allowed!");
                 static_assert(sz < 256, "too many alternative type in variant!");
-                constexpr auto body = get_variant_literal_impl<Arg>(dm_make_index_sequence<std::variant_size_v<Arg>>());
+                constexpr auto body = get_variant_literal_impl<Arg, Enclosing>(dm_make_index_sequence<std::variant_size_v<Arg>>());
                 //
                 // --- BEGIN: 已应用的修复 ---
                 //
@@ -232,32 +421,45 @@ namespace dm::pack {
             }
             else if constexpr (id == type_id::array_t) {
                 constexpr auto sz = dm_get_array_size_v<Arg>;
-                return ret + get_type_literal<dm_element_type_t<Arg>, Arg>() + get_size_literal<sz>();
+                return ret + get_type_literal<dm_element_type_t<Arg>, Arg, Enclosing>() + get_size_literal<sz>();
+            }
+            else if constexpr (id == type_id::container_t || id == type_id::optional_t || id == type_id::string_t || id == type_id::delta_container_t ||
+                id == type_id::xor_container_t) {
+                return ret + get_type_literal<dm_element_type_t<Arg>, Arg, Enclosing>();
             }
-            else if constexpr (id == type_id::container_t || id == type_id::optional_t || id == type_id::string_t) {
-                return ret + get_type_literal<dm_element_type_t<Arg>, Arg>();
+            else if constexpr (id == type_id::bitset_t) {
+                return ret + get_size_literal<Arg{}.size()>();
+            }
+            else if constexpr (id == type_id::shared_ptr_t || id == type_id::unique_ptr_t) {
+                using element_type = dm_remove_cv_t<typename Arg::element_type>;
+                constexpr std::size_t depth = enclosing_depth<element_type, Enclosing>::value;
+                if constexpr (depth != 0) {
+                    static_assert(depth < 256, "the recursive type is nested too deeply");
+                    return ret + string_literal<char, 2>{ {static_cast<char>(type_id::enclosing_t), static_cast<char>(depth)} };
+                }
+                else { return ret + get_type_literal<element_type, Arg, Enclosing>(); }
             }
             else if constexpr (id == type_id::set_container_t) {
-                return ret + get_type_literal<typename Arg::key_type, Arg>();
+                return ret + get_type_literal<typename Arg::key_type, Arg, Enclosing>();
             }
             else if constexpr (id == type_id::map_container_t) {
-                return ret + get_type_literal<typename Arg::key_type, Arg>() + get_type_literal<typename Arg::mapped_type, Arg>();
+                return ret + get_type_literal<typename Arg::key_type, Arg, Enclosing>() + get_type_literal<typename Arg::mapped_type, Arg, Enclosing>();
             }
             else if constexpr (id == type_id::expected_t) {
-                return ret + get_type_literal<typename Arg::value_type, Arg>() + get_type_literal<typename Arg::error_type, Arg>();
+                return ret + get_type_literal<typename Arg::value_type, Arg, Enclosing>() + get_type_literal<typename Arg::error_type, Arg, Enclosing>();
             }
             else if constexpr (id != type_id::compatible_t) { return ret; }
             else { return string_literal<char, 0>{}; }
         }
 
-        template <typename Args, typename ParentArg, std::size_t... I>
+        template <typename Args, typename ParentArg, typename Enclosing, std::size_t... I>
         constexpr decltype(auto) get_type_literal_impl(std::index_sequence<I...>) {
-            return ((get_type_literal<dm_remove_cvref_t<std::tuple_element_t<I, Args>>, ParentArg>()) + ...);
+            return ((get_type_literal<dm_remove_cvref_t<std::tuple_element_t<I, Args>>, ParentArg, Enclosing>()) + ...);
         }
 
-        template <typename Args, std::size_t... I>
+        template <typename Args, typename Enclosing, std::size_t... I>
         constexpr decltype(auto) get_variant_literal_impl(std::index_sequence<I...>) {
-            return ((get_type_literal<dm_remove_cvref_t<std::variant_alternative_t<I, Args>>, Args>()) + ...);
+            return ((get_type_literal<dm_remove_cvref_t<std::variant_alternative_t<I, Args>>, Args, Enclosing>()) + ...);
         }
 
         template <typename... Args>
@@ -283,7 +485,7 @@ namespace dm::pack {
             }
             else {
                 if (!flag) return -1;
-                if constexpr (id == type_id::aggregate_class_t) {
+                if constexpr (id == type_id::aggregate_class_t || id == type_id::packed_class_t) {
                     using subArgs = decltype(get_types(Arg{}));
                     return check_if_compatible_element_exist_help_coverage<depth, subArgs>(dm_make_index_sequence<std::tuple_size_v<subArgs>>());
                 }
@@ -329,16 +531,226 @@ namespace dm::pack {
             std::cerr << "Serialize Error! The container's size is greater than " << MAX_SIZE << std::endl;
             std::exit(EXIT_FAILURE);
         }
+        [[noreturn]] DMPACK_INLINE void exit_bounded_size(std::size_t max_length) {
+            std::cerr << "Serialize Error! The container's size is greater than its declared bound " << max_length << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
         [[noreturn]] DMPACK_INLINE void exit_valueless_variant() {
             std::cerr << "Serialize Error! The variant is valueless!" << std::endl;
             std::exit(EXIT_FAILURE);
         }
 
+        //-----------------------------------------------------------------------------
+        // std::shared_ptr 的引用去重
+        //
+        // 线上每个 shared_ptr 以一个 uint32 标记开头:
+        //   0     : 空指针
+        //   1     : 新对象，对象本身紧随其后，按出现顺序 (先序) 获得下一个编号
+        //   k >= 2: 指向编号为 k - 2 的已写出对象
+        // 同一次序列化/反序列化内，指向同一对象的多个 shared_ptr 只写出一次，解码后仍共享同一对象。
+        // 编号表挂在线程局部的 current_refs 上，由 serialize/deserialize 等入口按需建立。
+        //-----------------------------------------------------------------------------
+        constexpr uint32_t ref_null = 0;
+        constexpr uint32_t ref_inline = 1;
+        constexpr uint32_t ref_first_index = 2;
+
+        // 每个被指向类型一个唯一地址，用于区分同一地址上的不同类型，并拒绝跨类型的回引
+        template <typename T>
+        struct ref_type_key { static constexpr char id = 0; };
+
+        template <typename T>
+        DMPACK_INLINE const void* ref_type_of() { return &ref_type_key<dm_remove_cv_t<T>>::id; }
+
+        struct ref_entry {
+            std::shared_ptr<void> object;                    // 为空表示该对象在解码时被跳过
+            const void* type;
+        };
+
+        struct ref_context {
+            std::unordered_map<const void*, std::pair<const void*, uint32_t>> ids;   // 编码: 对象地址 -> (类型, 编号)
+            uint32_t next = 0;
+            std::vector<ref_entry> objects;                                          // 解码: 编号 -> 对象
+        };
+
+        inline thread_local ref_context* current_refs = nullptr;
+
+        template <bool Enable>
+        struct ref_scope {
+            ref_context refs;
+            ref_context* saved;
+
+            ref_scope() : saved(current_refs) { current_refs = &refs; }
+            ~ref_scope() { current_refs = saved; }
+            ref_scope(const ref_scope&) = delete;
+            ref_scope& operator=(const ref_scope&) = delete;
+        };
+
+        template <>
+        struct ref_scope<false> {};
+
+        template <std::size_t N>
+        constexpr bool literal_has_shared_ptr(const string_literal<char, N>& str) {
+            for (std::size_t i = 0; i < N; ++i) {
+                if (static_cast<uint8_t>(str[i]) == static_cast<uint8_t>(type_id::shared_ptr_t)) { return true; }
+            }
+            return false;
+        }
+
+        // 类型描述串中出现 shared_ptr 时才需要编号表; 数组长度字节偶尔误判只会多建一张空表
+        template <typename... Args>
+        inline constexpr bool dm_pack_has_shared_ptr_v = literal_has_shared_ptr(get_types_literal<dm_remove_cvref_t<Args>...>());
+
+        // 编码端: 返回 object 应写出的标记，首次出现时分配编号。没有编号表时总是内联写出
+        inline uint32_t ref_encode(const void* object, const void* type) {
+            ref_context* refs = current_refs;
+            if (refs == nullptr) { return ref_inline; }
+            auto [it, inserted] = refs->ids.try_emplace(object, type, refs->next);
+            if (!inserted) {
+                if (it->second.first == type) { return it->second.second + ref_first_index; }
+                it->second = { type, refs->next };
+            }
+            if (refs->next >= (std::numeric_limits<uint32_t>::max)() - ref_first_index) [[unlikely]] { exit_container_size(); }
+            ++refs->next;
+            return ref_inline;
+        }
+
+        // 解码端: 登记一个内联写出的对象，编号与编码端的先序保持一致
+        DMPACK_INLINE void ref_register(std::shared_ptr<void> object, const void* type) {
+            if (ref_context* refs = current_refs) { refs->objects.push_back({ std::move(object), type }); }
+        }
+
+        // 解码端: 解析回引标记。out 为空时只做检查 (跳过/校验)，type 为空时不检查类型
+        inline std::errc ref_resolve(uint32_t tag, const void* type, std::shared_ptr<void>* out) {
+            ref_context* refs = current_refs;
+            std::size_t index = tag - ref_first_index;
+            if (refs == nullptr || index >= refs->objects.size()) [[unlikely]] { return std::errc::invalid_argument; }
+            const ref_entry& entry = refs->objects[index];
+            if (type != nullptr && entry.type != nullptr && entry.type != type) [[unlikely]] { return std::errc::invalid_argument; }
+            if (out != nullptr) {
+                // 被指向的对象已被跳过 (如 get_path 略过的兄弟字段)，无法恢复共享关系
+                if (!entry.object) [[unlikely]] { return std::errc::not_supported; }
+                *out = entry.object;
+            }
+            return {};
+        }
+
+        template <typename Byte>
+        class unpacker;
+
+        /**
+         * @brief jagged<T> 的一行: 指向连续存放的元素，不拥有内存。
+         */
+        template <typename T>
+        class flat_row {
+        public:
+            using value_type = T;
+            using const_iterator = const T*;
+
+            constexpr flat_row() = default;
+            constexpr flat_row(const T* data, std::size_t size) : data_(data), size_(size) {}
+
+            constexpr const T* data() const { return data_; }
+            constexpr std::size_t size() const { return size_; }
+            constexpr bool empty() const { return size_ == 0; }
+            constexpr const T* begin() const { return data_; }
+            constexpr const T* end() const { return data_ + size_; }
+            constexpr const T& operator[](std::size_t i) const { return data_[i]; }
+
+        private:
+            const T* data_ = nullptr;
+            std::size_t size_ = 0;
+        };
+
+        /**
+         * @brief string_table 与 jagged<T> 的公共存储 (CSR): 所有元素连续存放，offsets[i]..offsets[i+1] 为第 i 行。
+         *
+         * 线上格式与 vector<vector<T>> (或 vector<string>) 相同，解码时先扫描一遍求出元素总数，
+         * 再一次分配元素与偏移两块内存，不为每一行单独分配。
+         */
+        template <typename T, typename Row>
+        class flat_table {
+            template <typename> friend class unpacker;
+
+        public:
+            using value_type = Row;
+            using element_type = T;
+
+            class const_iterator {
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type = Row;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = Row;
+
+                const_iterator() = default;
+                const_iterator(const flat_table* table, std::size_t index) : table_(table), index_(index) {}
+
+                Row operator*() const { return (*table_)[index_]; }
+                const_iterator& operator++() { ++index_; return *this; }
+                const_iterator operator++(int) { const_iterator old = *this; ++index_; return old; }
+                const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+                const_iterator operator+(difference_type n) const { return { table_, index_ + n }; }
+                difference_type operator-(const const_iterator& other) const { return static_cast<difference_type>(index_ - other.index_); }
+                bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+                bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+
+            private:
+                const flat_table* table_ = nullptr;
+                std::size_t index_ = 0;
+            };
+            using iterator = const_iterator;
+
+            flat_table() : offsets_(1, 0) {}
+
+            std::size_t size() const { return offsets_.size() - 1; }
+            bool empty() const { return size() == 0; }
+            Row operator[](std::size_t i) const { return Row(values_.data() + offsets_[i], offsets_[i + 1] - offsets_[i]); }
+            const_iterator begin() const { return { this, 0 }; }
+            const_iterator end() const { return { this, size() }; }
+
+            void reserve(std::size_t rows, std::size_t values) {
+                offsets_.reserve(rows + 1);
+                values_.reserve(values);
+            }
+
+            void clear() {
+                values_.clear();
+                offsets_.assign(1, 0);
+            }
+
+            // 全部元素与每行的起点 (共 size() + 1 项，末项为元素总数)
+            const std::vector<T>& values() const { return values_; }
+            const std::vector<std::size_t>& offsets() const { return offsets_; }
+
+            friend bool operator==(const flat_table& a, const flat_table& b) { return a.offsets_ == b.offsets_ && a.values_ == b.values_; }
+            friend bool operator!=(const flat_table& a, const flat_table& b) { return !(a == b); }
+
+        protected:
+            void append(const T* data, std::size_t n) {
+                values_.insert(values_.end(), data, data + n);
+                offsets_.push_back(values_.size());
+            }
+
+        private:
+            std::vector<T> values_;
+            std::vector<std::size_t> offsets_;
+        };
+
+        struct compact_layout;
+
+        // 表驱动编解码的解释器 compact_measure/compact_pack/compact_unpack 定义在文件末尾，经 ADL 找到
+        template <typename T>
+        const compact_layout& compact_layout_of();
+
         template <typename T, typename... Args>
         constexpr std::size_t DMPACK_INLINE calculate_needed_size(const T& item, const Args &...items);
 
         constexpr std::size_t DMPACK_INLINE calculate_needed_size() { return 0; }
 
+        template <typename T>
+        constexpr std::size_t calculate_pointee_size(const T& item);
+
         template <typename T>
         constexpr std::size_t DMPACK_INLINE calculate_one_size(const T& item) {
             using type = dm_remove_cvref_t<decltype(item)>;
@@ -346,14 +758,39 @@ namespace dm::pack {
             std::size_t total = 0;
             if constexpr (dm_is_monostate_v<type>) {}
             else if constexpr (dm_is_fundamental_v<type> || dm_is_enum_v<type>) { total += sizeof(type); }
-            else if constexpr (dm_is_same_v<std::string, type>) { total += (item.size() + sizeof(size_type)); }
+            else if constexpr (dm_pack_is_bounded_v<type>) { total += calculate_one_size(static_cast<const typename type::base&>(item)); }
+            else if constexpr (dm_pack_is_std_basic_string_v<type>) { total += (item.size() * sizeof(typename type::value_type) + sizeof(size_type)); }
+            else if constexpr (dm_pack_is_delta_vector_v<type>) { total += sizeof(size_type) + delta_encoded_size(item.data(), item.size()); }
+            else if constexpr (dm_pack_is_xor_vector_v<type>) { total += 2 * sizeof(size_type) + xor_encoded_size(item.data(), item.size()); }
+            else if constexpr (dm_pack_is_bool_vector_v<type>) { total += sizeof(size_type) + bits_encoded_size(item.size()); }
+            else if constexpr (dm_pack_is_bitset_v<type>) { total += bits_encoded_size(item.size()); }
+            else if constexpr (dm_pack_is_shared_ptr_v<type>) {
+                total += sizeof(uint32_t);
+                if (item && ref_encode(item.get(), ref_type_of<typename type::element_type>()) == ref_inline) { total += calculate_pointee_size(*item); }
+            }
+            else if constexpr (dm_pack_is_unique_ptr_v<type>) {
+                total += sizeof(char);
+                if (item) { total += calculate_pointee_size(*item); }
+            }
+            else if constexpr (dm_pack_is_flat_table_v<type>) {
+                total += sizeof(size_type) * (item.size() + 1) + item.values().size() * sizeof(typename type::element_type);
+            }
+            else if constexpr (dm_pack_is_split_v<type>) {
+                total += sizeof(size_type);
+                if constexpr (dm_pack_raw_v<typename type::value_type>) { total += item.size() * sizeof(typename type::value_type); }
+                else {
+                    for (std::size_t i = 0; i < item.size(); ++i) {
+                        item.visit(i, [&](const auto&... members) { total += calculate_needed_size(members...); });
+                    }
+                }
+            }
             else if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) {
-                if constexpr (dm_is_trivially_copyable_v<type>) { total += sizeof(type); }
+                if constexpr (dm_pack_raw_v<type>) { total += sizeof(type); }
                 else { for (auto& i : item) { total += calculate_one_size(i); } }
             }
             else if constexpr (dm_is_map_container_v<type> || (dm_is_container_v<type> && !dm_pack_string_v<type>)) {
                 total += sizeof(size_type);
-                if constexpr (dm_pack_trivially_copyable_container_v<type>) { total += item.size() * sizeof(typename type::value_type); }
+                if constexpr (dm_pack_raw_container_v<type>) { total += item.size() * sizeof(typename type::value_type); }
                 else { for (auto&& i : item) { total += calculate_one_size(i); } }
             }
             else if constexpr (dm_is_tuple_like_v<type>) {
@@ -384,7 +821,8 @@ namespace dm::pack {
                 else { total += calculate_one_size(item.error()); }
             }
             else if constexpr (dm_is_class_v<type>) {
-                if constexpr (dm_is_trivially_copyable_v<type>) { total += sizeof(type); }
+                if constexpr (dm_pack_raw_v<type>) { total += sizeof(type); }
+                else if constexpr (dm_pack_use_compact_v<type>) { total += compact_measure(compact_layout_of<type>(), &item); }
                 else { visit_members(item, [&](auto &&...items) DMPACK_CONSTEXPR_INLINE_LAMBDA{ total += calculate_needed_size(items...); }); }
             }
             else { static_assert(!sizeof(type), "the type is not supported yet"); }
@@ -401,11 +839,161 @@ namespace dm::pack {
             return calculate_one_size(item) + calculate_needed_size(items...);
         }
 
+        // 智能指针指向的对象经不强制内联的函数处理，递归类型 (如持有子节点指针的树节点) 的实例化因此能够终止
+        template <typename T>
+        constexpr std::size_t calculate_pointee_size(const T& item) { return calculate_one_size(item); }
+
+        template <typename T>
+        constexpr std::size_t min_wire_size();
+
+        template <typename Tuple, std::size_t... I>
+        constexpr std::size_t min_wire_size_sum(std::index_sequence<I...>) {
+            return (std::size_t{ 0 } + ... + min_wire_size<std::tuple_element_t<I, Tuple>>());
+        }
+
+        template <typename Variant, std::size_t... I>
+        constexpr std::size_t min_wire_size_variant(std::index_sequence<I...>) {
+            return (std::min)({ min_wire_size<std::variant_alternative_t<I, Variant>>()... });
+        }
+
+        // 类型 T 在线上至少占用的字节数，用于在遍历前用剩余长度一次性排除伪造的元素个数
+        template <typename T>
+        constexpr std::size_t min_wire_size() {
+            using type = dm_remove_cvref_t<T>;
+            if constexpr (dm_is_monostate_v<type> || dm_is_void_v<type>) { return 0; }
+            else if constexpr (dm_is_fundamental_v<type> || dm_is_enum_v<type>) { return sizeof(type); }
+            else if constexpr (dm_pack_is_xor_vector_v<type>) { return 2 * sizeof(size_type); }
+            else if constexpr (dm_pack_is_bitset_v<type>) { return bits_encoded_size(type{}.size()); }
+            else if constexpr (dm_pack_is_shared_ptr_v<type>) { return sizeof(uint32_t); }
+            else if constexpr (dm_pack_is_unique_ptr_v<type>) { return sizeof(char); }
+            else if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) {
+                if constexpr (dm_pack_raw_v<type>) { return sizeof(type); }
+                else { return dm_get_array_size_v<type> * min_wire_size<dm_element_type_t<type>>(); }
+            }
+            else if constexpr (dm_pack_is_std_basic_string_v<type> || dm_is_container_v<type>) { return sizeof(size_type); }
+            else if constexpr (dm_is_tuple_like_v<type>) {
+                using types = decltype(get_types(std::declval<type>()));
+                return min_wire_size_sum<types>(dm_make_index_sequence<std::tuple_size_v<types>>());
+            }
+            else if constexpr (dm_is_optional_v<type>) { return sizeof(char); }
+            else if constexpr (dm_is_variant_v<type>) {
+                return sizeof(uint32_t) + min_wire_size_variant<type>(dm_make_index_sequence<std::variant_size_v<type>>());
+            }
+            else if constexpr (dm_pack_expected_v<type>) {
+                return sizeof(bool) + (std::min)(min_wire_size<typename type::value_type>(), min_wire_size<typename type::error_type>());
+            }
+            else if constexpr (dm_is_class_v<type>) {
+                if constexpr (dm_pack_raw_v<type>) { return sizeof(type); }
+                else {
+                    using types = decltype(get_types(std::declval<type>()));
+                    return min_wire_size_sum<types>(dm_make_index_sequence<std::tuple_size_v<types>>());
+                }
+            }
+            else { return 0; }
+        }
+
+        // 含无界容器的类型没有编码长度上限
+        constexpr std::size_t unbounded_size = (std::numeric_limits<std::size_t>::max)();
+
+        constexpr std::size_t bound_add(std::size_t a, std::size_t b) {
+            return (a == unbounded_size || b == unbounded_size || a > unbounded_size - b) ? unbounded_size : a + b;
+        }
+
+        constexpr std::size_t bound_mul(std::size_t n, std::size_t b) {
+            return (b == unbounded_size || (b != 0 && n > unbounded_size / b)) ? unbounded_size : n * b;
+        }
+
+        template <typename T>
+        constexpr std::size_t max_wire_size();
+
+        template <typename Tuple, std::size_t... I>
+        constexpr std::size_t max_wire_size_sum(std::index_sequence<I...>) {
+            std::size_t total = 0;
+            ((total = bound_add(total, max_wire_size<std::tuple_element_t<I, Tuple>>())), ...);
+            return total;
+        }
+
+        template <typename Variant, std::size_t... I>
+        constexpr std::size_t max_wire_size_variant(std::index_sequence<I...>) {
+            return (std::max)({ max_wire_size<std::variant_alternative_t<I, Variant>>()... });
+        }
+
+        // 类型 T 在线上最多占用的字节数; 字符串和容器只有声明为 bounded 时才有上限
+        template <typename T>
+        constexpr std::size_t max_wire_size() {
+            using type = dm_remove_cvref_t<T>;
+            if constexpr (dm_is_monostate_v<type> || dm_is_void_v<type>) { return 0; }
+            else if constexpr (dm_is_fundamental_v<type> || dm_is_enum_v<type>) { return sizeof(type); }
+            else if constexpr (dm_pack_is_bounded_v<type>) {
+                using base = typename type::base;
+                std::size_t element = 0;
+                if constexpr (dm_pack_string_v<base>) { element = sizeof(typename base::value_type); }
+                else if constexpr (dm_is_map_container_v<base>) {
+                    element = bound_add(max_wire_size<typename base::key_type>(), max_wire_size<typename base::mapped_type>());
+                }
+                else { element = max_wire_size<typename base::value_type>(); }
+                return bound_add(sizeof(size_type), bound_mul(type::max_length, element));
+            }
+            else if constexpr (dm_pack_is_bitset_v<type>) { return bits_encoded_size(type{}.size()); }
+            else if constexpr (dm_pack_is_shared_ptr_v<type>) { return bound_add(sizeof(uint32_t), max_wire_size<typename type::element_type>()); }
+            else if constexpr (dm_pack_is_unique_ptr_v<type>) { return bound_add(sizeof(char), max_wire_size<typename type::element_type>()); }
+            else if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) {
+                if constexpr (dm_pack_raw_v<type>) { return sizeof(type); }
+                else { return bound_mul(dm_get_array_size_v<type>, max_wire_size<dm_element_type_t<type>>()); }
+            }
+            else if constexpr (dm_pack_is_std_basic_string_v<type> || dm_is_container_v<type>) { return unbounded_size; }
+            else if constexpr (dm_is_tuple_like_v<type>) {
+                using types = decltype(get_types(std::declval<type>()));
+                return max_wire_size_sum<types>(dm_make_index_sequence<std::tuple_size_v<types>>());
+            }
+            else if constexpr (dm_is_optional_v<type>) { return bound_add(sizeof(char), max_wire_size<typename type::value_type>()); }
+            else if constexpr (dm_is_variant_v<type>) {
+                return bound_add(sizeof(uint32_t), max_wire_size_variant<type>(dm_make_index_sequence<std::variant_size_v<type>>()));
+            }
+            else if constexpr (dm_pack_expected_v<type>) {
+                return bound_add(sizeof(bool), (std::max)(max_wire_size<typename type::value_type>(), max_wire_size<typename type::error_type>()));
+            }
+            else if constexpr (dm_is_class_v<type>) {
+                if constexpr (dm_pack_raw_v<type>) { return sizeof(type); }
+                else {
+                    using types = decltype(get_types(std::declval<type>()));
+                    return max_wire_size_sum<types>(dm_make_index_sequence<std::tuple_size_v<types>>());
+                }
+            }
+            else { return unbounded_size; }
+        }
+
+        // 检查 n 个连续存放的 T 是否都是合法取值: bool 只能是 0/1，声明了 enum_range 的枚举需落在范围内
+        template <typename T, typename Byte>
+        DMPACK_INLINE bool values_in_range(const Byte* p, std::size_t n) {
+            using type = dm_remove_cvref_t<T>;
+            if constexpr (dm_is_same_v<type, bool>) { return bool_bytes_valid(p, n); }
+            else if constexpr (dm_is_enum_v<type> && dm_pack_has_enum_range_v<type>) {
+                using underlying = dm_underlying_type_t<type>;
+                constexpr auto lo = static_cast<underlying>(enum_range<type>::min);
+                constexpr auto hi = static_cast<underlying>(enum_range<type>::max);
+                // 无分支累积，便于编译器向量化
+                bool bad = false;
+                for (std::size_t i = 0; i < n; ++i) {
+                    underlying v;
+                    std::memcpy(&v, p + i * sizeof(underlying), sizeof(underlying));
+                    bad |= (v < lo) | (v > hi);
+                }
+                return !bad;
+            }
+            else { return true; }
+        }
+
         template <typename T>
         constexpr uint32_t get_types_code() {
             return detail::get_types_code<T>(dm_make_index_sequence<std::tuple_size_v<T>>{});
         }
 
+        template <typename T, size_t... I>
+        constexpr decltype(auto) get_tuple_types_literal(std::index_sequence<I...>) {
+            return get_types_literal<dm_remove_cvref_t<std::tuple_element_t<I, T>>...>();
+        }
+
         template <typename T>
         constexpr int check_if_compatible_element_exist() {
             return detail::check_if_compatible_element_exist<T>(dm_make_index_sequence<std::tuple_size_v<T>>{});
@@ -417,8 +1005,13 @@ namespace dm::pack {
         template <typename T>
         inline constexpr bool unexist_compatible_member_v = check_if_compatible_element_exist<decltype(get_types(dm_remove_cvref_t<T>{})) > () == 0;
 
+        template <typename U>
+        struct compact_thunks;
+
         template <typename Byte>
         class packer {
+            template <typename> friend struct compact_thunks;
+
         public:
             packer(Byte* data) : data_(data) {}
             packer(const packer&) = delete;
@@ -426,8 +1019,9 @@ namespace dm::pack {
 
             template <typename T, typename... Args>
             DMPACK_INLINE void serialize(const T& t, const Args &...args) {
+                [[maybe_unused]] ref_scope<dm_pack_has_shared_ptr_v<T, Args...>> refs;
                 if constexpr (sizeof...(args) == 0) {
-                    constexpr uint32_t types_code = get_types_code<decltype(get_types(t))>();
+                    constexpr uint32_t types_code = get_types_code<top_level_types_t<T>>();
                     std::memcpy(data_ + pos_, &types_code, sizeof(uint32_t));
                     pos_ += sizeof(uint32_t);
                     serialize_one(t);
@@ -442,8 +1036,9 @@ namespace dm::pack {
 
             template <typename T, typename... Args>
             DMPACK_INLINE void serialize_with_size(uint64_t sz, const T& t, const Args &...args) {
+                [[maybe_unused]] ref_scope<dm_pack_has_shared_ptr_v<T, Args...>> refs;
                 if constexpr (sizeof...(args) == 0) {
-                    constexpr uint32_t types_code = get_types_code<decltype(get_types(t))>();
+                    constexpr uint32_t types_code = get_types_code<top_level_types_t<T>>();
                     std::memcpy(data_ + pos_, &types_code, sizeof(uint32_t));
                     std::memcpy(data_ + pos_ + sizeof(uint32_t), &sz, sizeof(uint64_t));
                     pos_ += sizeof(uint32_t) + sizeof(uint64_t);
@@ -479,8 +1074,12 @@ namespace dm::pack {
                     std::memcpy(data_ + pos_, &item, sizeof(type));
                     pos_ += sizeof(type);
                 }
+                else if constexpr (dm_pack_is_bounded_v<type>) {
+                    if (item.size() > type::max_length) [[unlikely]] { exit_bounded_size(type::max_length); }
+                    serialize_one(static_cast<const typename type::base&>(item));
+                }
                 else if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) {
-                    if constexpr (dm_is_trivially_copyable_v<type>) {
+                    if constexpr (dm_pack_raw_v<type>) {
                         std::memcpy(data_ + pos_, &item, sizeof(type));
                         pos_ += sizeof(type);
                     }
@@ -488,16 +1087,85 @@ namespace dm::pack {
                         for (auto& i : item) { serialize_one(i); }
                     }
                 }
+                else if constexpr (dm_pack_is_delta_vector_v<type>) {
+                    if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    size_type size = item.size();
+                    std::memcpy(data_ + pos_, &size, sizeof(size_type));
+                    pos_ += sizeof(size_type);
+                    pos_ += delta_encode(item.data(), item.size(), data_ + pos_);
+                }
+                else if constexpr (dm_pack_is_xor_vector_v<type>) {
+                    if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    size_type size = item.size();
+                    std::memcpy(data_ + pos_, &size, sizeof(size_type));
+                    pos_ += sizeof(size_type);
+                    auto bytes = xor_encode(item.data(), item.size(), data_ + pos_ + sizeof(size_type));
+                    if (bytes > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    size_type encoded_size = static_cast<size_type>(bytes);
+                    std::memcpy(data_ + pos_, &encoded_size, sizeof(size_type));
+                    pos_ += sizeof(size_type) + bytes;
+                }
+                else if constexpr (dm_pack_is_bool_vector_v<type>) {
+                    if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    size_type size = item.size();
+                    std::memcpy(data_ + pos_, &size, sizeof(size_type));
+                    pos_ += sizeof(size_type);
+                    bits_encode(item, item.size(), data_ + pos_);
+                    pos_ += bits_encoded_size(item.size());
+                }
+                else if constexpr (dm_pack_is_bitset_v<type>) {
+                    bits_encode(item, item.size(), data_ + pos_);
+                    pos_ += bits_encoded_size(item.size());
+                }
+                else if constexpr (dm_pack_is_shared_ptr_v<type>) {
+                    uint32_t tag = item ? ref_encode(item.get(), ref_type_of<typename type::element_type>()) : ref_null;
+                    std::memcpy(data_ + pos_, &tag, sizeof(uint32_t));
+                    pos_ += sizeof(uint32_t);
+                    if (tag == ref_inline) { serialize_pointee(*item); }
+                }
+                else if constexpr (dm_pack_is_unique_ptr_v<type>) {
+                    bool has_value = static_cast<bool>(item);
+                    std::memcpy(data_ + pos_, &has_value, sizeof(char));
+                    pos_ += sizeof(char);
+                    if (has_value) { serialize_pointee(*item); }
+                }
+                else if constexpr (dm_pack_is_flat_table_v<type>) {
+                    if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    size_type rows = static_cast<size_type>(item.size());
+                    std::memcpy(data_ + pos_, &rows, sizeof(size_type));
+                    pos_ += sizeof(size_type);
+                    for (std::size_t i = 0; i < item.size(); ++i) {
+                        auto row = item[i];
+                        if (row.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                        size_type len = static_cast<size_type>(row.size());
+                        std::memcpy(data_ + pos_, &len, sizeof(size_type));
+                        pos_ += sizeof(size_type);
+                        std::size_t bytes = row.size() * sizeof(typename type::element_type);
+                        if (bytes) { std::memcpy(data_ + pos_, row.data(), bytes); }
+                        pos_ += bytes;
+                    }
+                }
+                else if constexpr (dm_pack_is_split_v<type>) {
+                    if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
+                    size_type size = static_cast<size_type>(item.size());
+                    std::memcpy(data_ + pos_, &size, sizeof(size_type));
+                    pos_ += sizeof(size_type);
+                    for (std::size_t i = 0; i < item.size(); ++i) {
+                        // 整块拷贝的 T 连同填充一起写出，只能先还原出整行
+                        if constexpr (dm_pack_raw_v<typename type::value_type>) { serialize_one(item.load(i)); }
+                        else { item.visit(i, [this](const auto&... members) { this->serialize_many(members...); }); }
+                    }
+                }
                 else if constexpr (dm_is_map_container_v<type> || dm_is_container_v<type>) {
                     if (item.size() > MAX_SIZE) [[unlikely]] { exit_container_size(); }
                     size_type size = item.size();
                     std::memcpy(data_ + pos_, &size, sizeof(size_type));
                     pos_ += sizeof(size_type);
 
-                    if constexpr (dm_pack_trivially_copyable_container_v<type>) {
+                    if constexpr (dm_pack_raw_container_v<type>) {
                         using value_type = typename type::value_type;
                         auto sz = item.size() * sizeof(value_type);
-                        std::memcpy(data_ + pos_, item.data(), sz);
+                        if (sz) { std::memcpy(data_ + pos_, item.data(), sz); }
 
                         pos_ += sz;
                         return;
@@ -541,10 +1209,13 @@ namespace dm::pack {
                 }
                 else if constexpr (dm_is_class_v<type>) {
                     static_assert(dm_is_aggregate_v<dm_remove_cvref_t<type>>);
-                    if constexpr (dm_is_trivially_copyable_v<type>) {
+                    if constexpr (dm_pack_raw_v<type>) {
                         std::memcpy(data_ + pos_, &item, sizeof(type));
                         pos_ += sizeof(type);
                     }
+                    else if constexpr (dm_pack_use_compact_v<type>) {
+                        pos_ += compact_pack(compact_layout_of<type>(), &item, reinterpret_cast<char*>(data_ + pos_));
+                    }
                     else {
                         visit_members(item, [this](auto &&...items) DMPACK_CONSTEXPR_INLINE_LAMBDA{ this->serialize_many(items...); });
                     }
@@ -553,12 +1224,128 @@ namespace dm::pack {
                 return;
             }
 
+            // 见 calculate_pointee_size
+            template <typename T>
+            void serialize_pointee(const T& item) { serialize_one(item); }
+
             Byte* data_;
             std::size_t pos_{};
         };
 
+        template <typename T>
+        struct type_tag { using type = T; };
+
+        // 字段路径中可以按下标进入的序列: 数组与逐元素编码的顺序容器
+        template <typename T>
+        inline constexpr bool dm_pack_path_sequence_v = dm_is_c_array_v<T> || dm_is_std_array_v<T> ||
+            (dm_is_container_v<T> && !dm_is_map_container_v<T> && !dm_is_set_container_v<T> && !dm_pack_string_v<T> &&
+                !dm_pack_is_delta_vector_v<T> && !dm_pack_is_xor_vector_v<T> && !dm_pack_is_bool_vector_v<T>);
+
+        template <typename T, std::size_t I>
+        constexpr auto path_element() {
+            using type = dm_remove_cvref_t<T>;
+            if constexpr (dm_pack_path_sequence_v<type>) {
+                return type_tag<dm_remove_cvref_t<dm_element_type_t<type>>>{};
+            }
+            else {
+                static_assert(dm_is_tuple_like_v<type> || dm_is_class_v<type>, "field path can only step into aggregates, tuples, arrays and sequence containers");
+                using types = decltype(get_types(std::declval<type>()));
+                static_assert(I < std::tuple_size_v<types>, "field index out of range");
+                return type_tag<dm_remove_cvref_t<std::tuple_element_t<I, types>>>{};
+            }
+        }
+
+        template <typename T, std::size_t... Path>
+        struct path_field { using type = dm_remove_cvref_t<T>; };
+
+        template <typename T, std::size_t I, std::size_t... Rest>
+        struct path_field<T, I, Rest...> {
+            using type = typename path_field<typename decltype(path_element<T, I>())::type, Rest...>::type;
+        };
+
+        // 沿字段路径 (结构体/tuple 取第 I 个成员，数组/顺序容器取第 I 个元素) 得到的字段类型
+        template <typename T, std::size_t... Path>
+        using path_field_t = typename path_field<T, Path...>::type;
+
+        // 在内存中的对象上沿字段路径取成员
+        template <typename T>
+        DMPACK_INLINE T& member_path(T& obj) { return obj; }
+
+        template <std::size_t I, std::size_t... Rest, typename T>
+        DMPACK_INLINE decltype(auto) member_path(T& obj) {
+            if constexpr (dm_is_c_array_v<T> || dm_is_std_array_v<T>) { return member_path<Rest...>(obj[I]); }
+            else {
+                return member_path<Rest...>(visit_members(obj, [](auto &...members) -> decltype(auto) {
+                    return std::get<I>(std::tie(members...));
+                }));
+            }
+        }
+
+        // 以运行期下标访问聚合体/tuple 的第 index 个成员
+        template <typename U, typename F>
+        DMPACK_INLINE std::errc visit_member_at(U& item, int index, F&& f) {
+            std::errc code = std::errc::invalid_argument;
+            auto pick = [&](auto&... members) {
+                int i = 0;
+                ((i++ == index ? (void)(code = f(members)) : (void)0), ...);
+                (void)i;
+            };
+            if constexpr (dm_is_tuple_like_v<dm_remove_cvref_t<U>>) { std::apply(pick, item); }
+            else { visit_members(item, pick); }
+            return code;
+        }
+
+        // 每次解引用都用 memcpy 从未对齐的字节流中读出一个 T，
+        // 使 vector::assign 能直接在未初始化的内存上构造元素，省去先清零再覆盖的一遍写入
+        template <typename T, typename Byte>
+        class unaligned_iterator {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = T;
+
+            explicit unaligned_iterator(const Byte* p) : p_(p) {}
+
+            DMPACK_INLINE T operator*() const {
+                T value;
+                std::memcpy(&value, p_, sizeof(T));
+                return value;
+            }
+            DMPACK_INLINE T operator[](difference_type n) const { return *(*this + n); }
+
+            DMPACK_INLINE unaligned_iterator& operator++() { p_ += sizeof(T); return *this; }
+            DMPACK_INLINE unaligned_iterator operator++(int) { auto tmp = *this; p_ += sizeof(T); return tmp; }
+            DMPACK_INLINE unaligned_iterator& operator--() { p_ -= sizeof(T); return *this; }
+            DMPACK_INLINE unaligned_iterator operator--(int) { auto tmp = *this; p_ -= sizeof(T); return tmp; }
+            DMPACK_INLINE unaligned_iterator& operator+=(difference_type n) { p_ += n * static_cast<difference_type>(sizeof(T)); return *this; }
+            DMPACK_INLINE unaligned_iterator& operator-=(difference_type n) { p_ -= n * static_cast<difference_type>(sizeof(T)); return *this; }
+            DMPACK_INLINE unaligned_iterator operator+(difference_type n) const { auto tmp = *this; return tmp += n; }
+            DMPACK_INLINE unaligned_iterator operator-(difference_type n) const { auto tmp = *this; return tmp -= n; }
+            DMPACK_INLINE difference_type operator-(const unaligned_iterator& other) const { return (p_ - other.p_) / static_cast<difference_type>(sizeof(T)); }
+
+            DMPACK_INLINE bool operator==(const unaligned_iterator& other) const { return p_ == other.p_; }
+            DMPACK_INLINE bool operator!=(const unaligned_iterator& other) const { return p_ != other.p_; }
+            DMPACK_INLINE bool operator<(const unaligned_iterator& other) const { return p_ < other.p_; }
+            DMPACK_INLINE bool operator>(const unaligned_iterator& other) const { return p_ > other.p_; }
+            DMPACK_INLINE bool operator<=(const unaligned_iterator& other) const { return p_ <= other.p_; }
+            DMPACK_INLINE bool operator>=(const unaligned_iterator& other) const { return p_ >= other.p_; }
+
+        private:
+            const Byte* p_;
+        };
+
+        template <typename Byte>
+        class migrate_reader;
+
         template <typename Byte>
         class unpacker {
+            template <typename> friend class unpacker;
+            template <typename> friend class migrate_reader;
+            template <typename> friend struct compact_thunks;
+            friend std::errc compact_unpack(const compact_layout& layout, void* obj, unpacker<char>& in);
+
         public:
             unpacker() = delete;
             unpacker(const unpacker&) = delete;
@@ -568,9 +1355,15 @@ namespace dm::pack {
                 : data_{ data }, size_(size) {
             }
 
+            // budget: 解码过程中允许新分配的内存上限 (按元素大小估算)，超出时返回 std::errc::not_enough_memory
+            DMPACK_INLINE unpacker(const Byte* data, std::size_t size, std::size_t budget)
+                : data_{ data }, size_(size), budget_(budget) {
+            }
+
             template <class T>
             DMPACK_INLINE std::errc deserialize(T& t) {
-                auto&& [err_code, data_len] = check_types(t);
+                [[maybe_unused]] ref_scope<dm_pack_has_shared_ptr_v<T>> refs;
+                auto&& [err_code, data_len] = check_types<T>();
                 if (err_code != std::errc{}) [[unlikely]] {
                     return err_code;
                 }
@@ -579,7 +1372,8 @@ namespace dm::pack {
 
             template <class T>
             DMPACK_INLINE std::errc deserialize(T& t, std::size_t& len) {
-                auto&& [err_code, data_len] = check_types(t);
+                [[maybe_unused]] ref_scope<dm_pack_has_shared_ptr_v<T>> refs;
+                auto&& [err_code, data_len] = check_types<T>();
                 if (err_code != std::errc{}) [[unlikely]] {
                     return err_code;
                 }
@@ -588,77 +1382,77 @@ namespace dm::pack {
                 return ret;
             }
 
-            template <typename U, size_t I>
-            DMPACK_INLINE
-                ::dm::pack::deserialize_result<dm_remove_cvref_t<std::tuple_element_t<
-                I, decltype(get_types(std::declval<dm_remove_cvref_t<U>>()))>>>
-                get_field() {
-                using T = dm_remove_cvref_t<U>;
-
-                T t{};
-                using types = decltype(get_types(t));
-                using Filed = dm_remove_cvref_t<std::tuple_element_t<I, types>>;
-
-                std::errc code{};
-                Filed field{};
-                if (auto [err_code, _] = check_types(t); err_code != std::errc{}) [[unlikely]] {
-                    return { err_code, field };
+            /**
+             * @brief 只解码字段路径 Path 指向的那个字段。
+             *
+             * 路径之前的兄弟字段只按长度头跳过，不构造任何对象；
+             * 顺序容器的下标越界时返回 std::errc::result_out_of_range；
+             * 目标字段中的 shared_ptr 回引到被跳过的对象时返回 std::errc::not_supported。
+             */
+            template <typename T, std::size_t... Path>
+            DMPACK_INLINE ::dm::pack::deserialize_result<path_field_t<T, Path...>> get_path() {
+                [[maybe_unused]] ref_scope<dm_pack_has_shared_ptr_v<T>> refs;
+                ::dm::pack::deserialize_result<path_field_t<T, Path...>> ret{};
+                auto&& [err_code, data_len] = check_types<T>();
+                if (err_code != std::errc{}) [[unlikely]] {
+                    ret.errc = err_code;
+                    return ret;
                 }
+                ret.errc = decode_path<T, Path...>(ret.value);
+                return ret;
+            }
 
-                if constexpr (dm_is_tuple_v<T>) {
-                    std::apply(
-                        [this, &code, &field](auto &&...items) DMPACK_CONSTEXPR_INLINE_LAMBDA{
-                          static_assert(I < sizeof...(items), "out of range");
-                          code = this->template for_each<I>(field, items...);
-                        },
-                        t);
-                }
-                else if constexpr (dm_is_class_v<T>) {
-                    static_assert(dm_is_aggregate_v<T>);
-                    visit_members(t, [this, &code, &field](auto &&...items) DMPACK_CONSTEXPR_INLINE_LAMBDA{
-                      static_assert(I < sizeof...(items), "out of range");
-                      code = this->template for_each<I>(field, items...);
-                        });
-                }
+            template <typename U, size_t I>
+            DMPACK_INLINE ::dm::pack::deserialize_result<path_field_t<U, I>> get_field() {
+                return get_path<dm_remove_cvref_t<U>, I>();
+            }
 
-                pos_ = 0;
-                return { code, std::move(field) };
+            // 只校验不解码: 检查长度、variant 下标、bool/枚举取值、shared_ptr 回引和嵌套深度，
+            // 除 shared_ptr 的编号表外不分配任何内存
+            template <class T>
+            DMPACK_INLINE std::errc validate() {
+                [[maybe_unused]] ref_scope<dm_pack_has_shared_ptr_v<T>> refs;
+                auto&& [err_code, data_len] = check_types<T>();
+                if (err_code != std::errc{}) [[unlikely]] {
+                    return err_code;
+                }
+                return skip_one<T, true>(0);
             }
 
         private:
             template <size_t index, typename unpack, typename variant_t>
             struct variant_construct_helper_not_skipped {
-                static DMPACK_INLINE void run(unpack& unpacker, variant_t& v) {
+                static DMPACK_INLINE std::errc run(unpack& unpacker, variant_t& v) {
                     if constexpr (index >= std::variant_size_v<variant_t>) {
-                        return;
+                        return std::errc::invalid_argument;
                     }
                     else {
                         v.template emplace<index>();
-                        unpacker.template deserialize_one<true>(std::get<index>(v));
+                        return unpacker.template deserialize_one<true>(std::get<index>(v));
                     }
                 }
             };
 
             template <size_t index, typename unpack, typename variant_t>
             struct variant_construct_helper_skipped {
-                static DMPACK_INLINE void run(unpack& unpacker, variant_t& v) {
+                static DMPACK_INLINE std::errc run(unpack& unpacker, variant_t& v) {
                     if constexpr (index >= std::variant_size_v<variant_t>) {
-                        return;
+                        return std::errc::invalid_argument;
                     }
                     else {
                         v.template emplace<index>();
-                        unpacker.template deserialize_one<false>(std::get<index>(v));
+                        return unpacker.template deserialize_one<false>(std::get<index>(v));
                     }
                 };
             };
 
             template <class T>
-            DMPACK_INLINE std::pair<std::errc, std::size_t> check_types(T& t) {
+            DMPACK_INLINE std::pair<std::errc, std::size_t> check_types() {
                 if (size_ < sizeof(uint32_t)) [[unlikely]] {
                     return { std::errc::no_buffer_space, 0 };
                 }
 
-                constexpr uint32_t types_code = get_types_code<decltype(get_types(t))>();
+                constexpr uint32_t types_code = get_types_code<top_level_types_t<T>>();
                 uint32_t current_types_code{};
                 std::memcpy(&current_types_code, data_ + pos_, sizeof(uint32_t));
                 if ((current_types_code / 2) != (types_code / 2)) [[unlikely]] {
@@ -710,8 +1504,12 @@ namespace dm::pack {
                     if constexpr (NotSkip) { std::memcpy(&item, data_ + pos_, sizeof(type)); }
                     pos_ += sizeof(type);
                 }
+                else if constexpr (dm_pack_is_bounded_v<type>) {
+                    if ((code = check_bound(type::max_length)) != std::errc{}) [[unlikely]] { return code; }
+                    code = deserialize_one<NotSkip>(static_cast<typename type::base&>(item));
+                }
                 else if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) {
-                    if constexpr (dm_is_trivially_copyable_v<type>) {
+                    if constexpr (dm_pack_raw_v<type>) {
                         if (pos_ + sizeof(type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
                         if constexpr (NotSkip) { std::memcpy(&item, data_ + pos_, sizeof(type)); }
                         pos_ += sizeof(type);
@@ -723,20 +1521,154 @@ namespace dm::pack {
                         }
                     }
                 }
+                else if constexpr (dm_pack_is_delta_vector_v<type>) {
+                    size_type container_size = 0;
+                    if (pos_ + sizeof(size_type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(&container_size, data_ + pos_, sizeof(size_type));
+                    pos_ += sizeof(size_type);
+                    using value_type = typename type::value_type;
+                    value_type* out = nullptr;
+                    if (delta_min_encoded_size(container_size) > size_ - pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if constexpr (NotSkip) {
+                        if (!charge(container_size * sizeof(value_type))) [[unlikely]] { return std::errc::not_enough_memory; }
+                        item.resize(container_size);
+                        out = item.data();
+                    }
+                    std::size_t consumed = 0;
+                    code = delta_decode(data_ + pos_, size_ - pos_, container_size, out, consumed);
+                    if (code != std::errc{}) [[unlikely]] { return code; }
+                    pos_ += consumed;
+                }
+                else if constexpr (dm_pack_is_xor_vector_v<type>) {
+                    size_type container_size = 0;
+                    size_type encoded_size = 0;
+                    if (pos_ + 2 * sizeof(size_type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(&container_size, data_ + pos_, sizeof(size_type));
+                    std::memcpy(&encoded_size, data_ + pos_ + sizeof(size_type), sizeof(size_type));
+                    pos_ += 2 * sizeof(size_type);
+                    if (pos_ + encoded_size > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    // 每个值至少占 1 位
+                    if (container_size > static_cast<std::size_t>(encoded_size) * 8) [[unlikely]] { return std::errc::invalid_argument; }
+                    if constexpr (NotSkip) {
+                        if (!charge(container_size * sizeof(typename type::value_type))) [[unlikely]] { return std::errc::not_enough_memory; }
+                        item.resize(container_size);
+                        code = xor_decode(data_ + pos_, encoded_size, container_size, item.data());
+                        if (code != std::errc{}) [[unlikely]] { return code; }
+                    }
+                    pos_ += encoded_size;
+                }
+                else if constexpr (dm_pack_is_bool_vector_v<type>) {
+                    size_type container_size = 0;
+                    if (pos_ + sizeof(size_type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(&container_size, data_ + pos_, sizeof(size_type));
+                    pos_ += sizeof(size_type);
+                    std::size_t mem_sz = bits_encoded_size(container_size);
+                    if (pos_ + mem_sz > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if constexpr (NotSkip) {
+                        if (!charge(mem_sz)) [[unlikely]] { return std::errc::not_enough_memory; }
+                        item.assign(container_size, false);
+                        bits_decode(data_ + pos_, container_size, item);
+                    }
+                    pos_ += mem_sz;
+                }
+                else if constexpr (dm_pack_is_bitset_v<type>) {
+                    std::size_t mem_sz = bits_encoded_size(item.size());
+                    if (pos_ + mem_sz > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if constexpr (NotSkip) {
+                        item.reset();
+                        bits_decode(data_ + pos_, item.size(), item);
+                    }
+                    pos_ += mem_sz;
+                }
+                else if constexpr (dm_pack_is_shared_ptr_v<type>) {
+                    using value_type = dm_remove_cv_t<typename type::element_type>;
+                    uint32_t tag = 0;
+                    if (pos_ + sizeof(uint32_t) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(&tag, data_ + pos_, sizeof(uint32_t));
+                    pos_ += sizeof(uint32_t);
+                    if (tag == ref_null) { if constexpr (NotSkip) { item.reset(); } }
+                    else if (tag == ref_inline) {
+                        if constexpr (NotSkip) {
+                            if (!charge(sizeof(value_type))) [[unlikely]] { return std::errc::not_enough_memory; }
+                            auto object = std::make_shared<value_type>();
+                            ref_register(object, ref_type_of<value_type>());
+                            code = deserialize_pointee<NotSkip>(*object);
+                            item = std::move(object);
+                        }
+                        else {
+                            ref_register(nullptr, ref_type_of<value_type>());
+                            value_type useless{};
+                            code = deserialize_pointee<NotSkip>(useless);
+                        }
+                    }
+                    else if constexpr (NotSkip) {
+                        std::shared_ptr<void> object;
+                        code = ref_resolve(tag, ref_type_of<value_type>(), &object);
+                        if (code == std::errc{}) { item = std::static_pointer_cast<value_type>(std::move(object)); }
+                    }
+                    else { code = ref_resolve(tag, ref_type_of<value_type>(), nullptr); }
+                }
+                else if constexpr (dm_pack_is_unique_ptr_v<type>) {
+                    using value_type = typename type::element_type;
+                    bool has_value{};
+                    code = read_flag(has_value);
+                    if (code != std::errc{}) [[unlikely]] { return code; }
+                    if (!has_value) { if constexpr (NotSkip) { item.reset(); } return {}; }
+                    if constexpr (NotSkip) {
+                        if (!item) {
+                            if (!charge(sizeof(value_type))) [[unlikely]] { return std::errc::not_enough_memory; }
+                            item = std::make_unique<value_type>();
+                        }
+                        code = deserialize_pointee<NotSkip>(*item);
+                    }
+                    else { dm_remove_cv_t<value_type> useless{}; code = deserialize_pointee<NotSkip>(useless); }
+                }
+                else if constexpr (dm_pack_is_flat_table_v<type>) { code = deserialize_flat<NotSkip>(item); }
+                else if constexpr (dm_pack_is_split_v<type>) {
+                    using value_type = typename type::value_type;
+                    size_type container_size = 0;
+                    if ((code = read_size(container_size)) != std::errc{}) [[unlikely]] { return code; }
+                    if constexpr (NotSkip) {
+                        item.clear();
+                        if (!charge(container_size * sizeof(value_type))) [[unlikely]] { return std::errc::not_enough_memory; }
+                        constexpr size_t min_size = (std::max)(min_wire_size<value_type>(), size_t{ 1 });
+                        item.reserve(std::min<size_t>(container_size, (size_ - pos_) / min_size));
+                    }
+                    for (size_t i = 0; i < container_size; ++i) {
+                        value_type value{};
+                        code = deserialize_one<NotSkip>(value);
+                        if (code != std::errc{}) [[unlikely]] { return code; }
+                        if constexpr (NotSkip) { item.push_back(std::move(value)); }
+                    }
+                }
                 else if constexpr (dm_is_map_container_v<type>) {
                     size_type container_size = 0;
                     if (pos_ + sizeof(size_type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
                     std::memcpy(&container_size, data_ + pos_, sizeof(size_type));
                     pos_ += sizeof(size_type);
-                    if (container_size == 0) [[likely]] { return {}; }
                     if constexpr (NotSkip) { item.clear(); }
+                    if (container_size == 0) [[likely]] { return {}; }
                     using key_type = typename type::key_type;
                     using value_type = typename type::mapped_type;
-                    for (size_t i = 0; i < container_size; ++i) {
-                        std::pair<key_type, value_type> pair{};
-                        code = deserialize_one<NotSkip>(pair);
-                        if (code != std::errc{}) [[unlikely]] { return code; }
-                        if constexpr (NotSkip) { item.emplace(std::move(pair)); }
+                    if constexpr (NotSkip) {
+                        if (!charge(container_size * (sizeof(typename type::value_type) + node_overhead))) [[unlikely]] { return std::errc::not_enough_memory; }
+                        // 先解出 key，再在节点内原地解 value，避免 pair 的默认构造与整体移动
+                        key_type key{};
+                        for (size_t i = 0; i < container_size; ++i) {
+                            code = deserialize_one<NotSkip>(key);
+                            if (code != std::errc{}) [[unlikely]] { return code; }
+                            auto it = item.emplace_hint(item.end(), std::piecewise_construct,
+                                std::forward_as_tuple(std::move(key)), std::forward_as_tuple());
+                            code = deserialize_one<NotSkip>(it->second);
+                            if (code != std::errc{}) [[unlikely]] { return code; }
+                        }
+                    }
+                    else {
+                        for (size_t i = 0; i < container_size; ++i) {
+                            std::pair<key_type, value_type> pair{};
+                            code = deserialize_one<NotSkip>(pair);
+                            if (code != std::errc{}) [[unlikely]] { return code; }
+                        }
                     }
                 }
                 else if constexpr (dm_is_container_v<type>) {
@@ -744,41 +1676,57 @@ namespace dm::pack {
                     if (pos_ + sizeof(size_type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
                     std::memcpy(&container_size, data_ + pos_, sizeof(size_type));
                     pos_ += sizeof(size_type);
-                    if (container_size == 0) [[likely]] { return {}; }
-                    if constexpr (NotSkip) { item.clear(); }
 
                     if constexpr (dm_is_set_container_v<type>) {
-                        typename type::value_type value;
+                        if constexpr (NotSkip) {
+                            item.clear();
+                            if (!charge(container_size * (sizeof(typename type::value_type) + node_overhead))) [[unlikely]] { return std::errc::not_enough_memory; }
+                        }
+                        typename type::value_type value{};
                         for (size_t i = 0; i < container_size; ++i) {
                             code = deserialize_one<NotSkip>(value);
                             if (code != std::errc{}) [[unlikely]] { return code; }
-                            if constexpr (NotSkip) { item.emplace(std::move(value)); }
+                            if constexpr (NotSkip) { item.emplace_hint(item.end(), std::move(value)); }
                         }
                     }
                     else {
                         using value_type = typename type::value_type;
                         size_t mem_sz = container_size * sizeof(value_type);
-                        if constexpr (dm_pack_trivially_copyable_container_v<type>) {
+                        if constexpr (dm_pack_raw_container_v<type>) {
                             if (pos_ + mem_sz > size_) [[unlikely]] { return std::errc::no_buffer_space; }
                             if constexpr (NotSkip) {
                                 if constexpr (dm_pack_string_view_v<type>) { item = { reinterpret_cast<const char*>(data_ + pos_), container_size }; }
                                 else {
-                                    item.resize(container_size);
-                                    std::memcpy(item.data(), data_ + pos_, mem_sz);
+                                    if (!charge(mem_sz)) [[unlikely]] { return std::errc::not_enough_memory; }
+                                    assign_from_wire(item, container_size);
                                 }
                             }
                             pos_ += mem_sz;
                         }
+                        else if constexpr (NotSkip) {
+                            if (!charge(mem_sz)) [[unlikely]] { return std::errc::not_enough_memory; }
+                            // 复用已有元素 (及其内部已分配的内存)，不足的部分在末尾原地构造后直接解码
+                            size_t i = 0;
+                            auto it = item.begin();
+                            for (; i < container_size && it != item.end(); ++i, ++it) {
+                                code = deserialize_one<NotSkip>(*it);
+                                if (code != std::errc{}) [[unlikely]] { return code; }
+                            }
+                            item.erase(it, item.end());
+                            if constexpr (dm_pack_has_reserve_v<type>) {
+                                // 元素个数来自输入，预留时以剩余字节数为上限，防止伪造的长度触发巨量分配
+                                constexpr size_t min_size = (std::max)(min_wire_size<value_type>(), size_t{ 1 });
+                                item.reserve(std::min<size_t>(container_size, i + (size_ - pos_) / min_size));
+                            }
+                            for (; i < container_size; ++i) {
+                                code = deserialize_one<NotSkip>(item.emplace_back());
+                                if (code != std::errc{}) [[unlikely]] { return code; }
+                            }
+                        }
                         else {
-                            if constexpr (NotSkip) { item.resize(container_size); }
                             for (size_t i = 0; i < container_size; ++i) {
-                                if constexpr (NotSkip) {
-                                    code = deserialize_one<NotSkip>(item[i]);
-                                }
-                                else {
-                                    value_type useless;
-                                    code = deserialize_one<NotSkip>(useless);
-                                }
+                                value_type useless;
+                                code = deserialize_one<NotSkip>(useless);
                                 if (code != std::errc{}) [[unlikely]] { return code; }
                             }
                         }
@@ -791,16 +1739,18 @@ namespace dm::pack {
                         code = deserialize_one<NotSkip>(item.second);
                     }
                     else {
-                        std::apply([this](auto &&...items) DMPACK_CONSTEXPR_INLINE_LAMBDA{ this->template deserialize_many<NotSkip>(items...); }, item);
+                        code = std::apply([this](auto &&...items) DMPACK_CONSTEXPR_INLINE_LAMBDA{ return this->template deserialize_many<NotSkip>(items...); }, item);
                     }
                 }
                 else if constexpr (dm_is_optional_v<type>) {
-                    if (pos_ + sizeof(bool) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
                     bool has_value{};
-                    std::memcpy(&has_value, data_ + pos_, sizeof(bool));
-                    pos_ += sizeof(bool);
+                    code = read_flag(has_value);
+                    if (code != std::errc{}) [[unlikely]] { return code; }
                     if (!has_value) [[unlikely]] { if constexpr (NotSkip) { item.reset(); } return {}; }
-                    if constexpr (NotSkip) { item.emplace(); code = deserialize_one<NotSkip>(item.value()); }
+                    if constexpr (NotSkip) {
+                        if (!item.has_value()) { item.emplace(); }
+                        code = deserialize_one<NotSkip>(*item);
+                    }
                     else { typename type::value_type val; code = deserialize_one<NotSkip>(val); }
                 }
                 else if constexpr (dm_is_variant_v<type>) {
@@ -809,14 +1759,13 @@ namespace dm::pack {
                     std::memcpy(&index, data_ + pos_, sizeof(index));
                     pos_ += sizeof(index);
                     if (index >= std::variant_size_v<type>) [[unlikely]] { return std::errc::invalid_argument; }
-                    if constexpr (NotSkip) { template_switch<variant_construct_helper_not_skipped>(index, *this, item); }
-                    else { template_switch<variant_construct_helper_skipped>(index, *this, item); }
+                    if constexpr (NotSkip) { code = template_switch<variant_construct_helper_not_skipped>(index, *this, item); }
+                    else { code = template_switch<variant_construct_helper_skipped>(index, *this, item); }
                 }
                 else if constexpr (dm_pack_expected_v<type>) {
-                    if (pos_ + sizeof(bool) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
                     bool has_value{};
-                    std::memcpy(&has_value, data_ + pos_, sizeof(bool));
-                    pos_ += sizeof(bool);
+                    code = read_flag(has_value);
+                    if (code != std::errc{}) [[unlikely]] { return code; }
                     if (has_value) {
                         if constexpr (!dm_is_void_v<typename type::value_type>) {
                             if constexpr (NotSkip) { if (!item.has_value()) item.emplace(); code = deserialize_one<NotSkip>(item.value()); }
@@ -831,52 +1780,563 @@ namespace dm::pack {
                 }
                 else if constexpr (dm_is_class_v<type>) {
                     static_assert(dm_is_aggregate_v<dm_remove_cvref_t<type>>);
-                    if constexpr (dm_is_trivially_copyable_v<type>) {
+                    if constexpr (dm_pack_raw_v<type>) {
                         if (pos_ + sizeof(type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
                         if constexpr (NotSkip) { std::memcpy(&item, data_ + pos_, sizeof(type)); }
                         pos_ += sizeof(type);
                     }
+                    else if constexpr (NotSkip && dm_pack_use_compact_v<type>) {
+                        code = deserialize_compact(compact_layout_of<type>(), &item);
+                    }
+                    else {
+                        code = visit_members(item, [this](auto &&...items) DMPACK_CONSTEXPR_INLINE_LAMBDA{ return this->template deserialize_many<NotSkip>(items...); });
+                    }
+                }
+                else { static_assert(!sizeof(type), "the type is not supported yet"); }
+                return code;
+            }
+
+            // 见 calculate_pointee_size; 递归类型的嵌套层数来自输入，超过 DMPACK_MAX_DEPTH 即视为非法
+            template <bool NotSkip, typename T>
+            std::errc deserialize_pointee(T& item) {
+                if (pointee_depth_ >= DMPACK_MAX_DEPTH) [[unlikely]] { return std::errc::invalid_argument; }
+                ++pointee_depth_;
+                std::errc code = deserialize_one<NotSkip>(item);
+                --pointee_depth_;
+                return code;
+            }
+
+            // 表驱动解码统一在 unpacker<char> 上执行，其它字节类型共用同一份解释器
+            DMPACK_INLINE std::errc deserialize_compact(const compact_layout& layout, void* obj) {
+                if constexpr (dm_is_same_v<Byte, char>) { return compact_unpack(layout, obj, *this); }
+                else {
+                    unpacker<char> in(reinterpret_cast<const char*>(data_), size_, budget_);
+                    in.pos_ = pos_;
+                    in.pointee_depth_ = pointee_depth_;
+                    std::errc code = compact_unpack(layout, obj, in);
+                    pos_ = in.pos_;
+                    budget_ = in.budget_;
+                    return code;
+                }
+            }
+
+            // string_table/jagged: 第一遍检查各行长度并求出元素总数，第二遍整块拷贝，元素与偏移各只分配一次
+            template <bool NotSkip, typename T>
+            DMPACK_INLINE std::errc deserialize_flat(T& item) {
+                using element_type = typename T::element_type;
+                size_type rows = 0;
+                std::errc code = read_size(rows);
+                if (code != std::errc{}) [[unlikely]] { return code; }
+                if (rows > (size_ - pos_) / sizeof(size_type)) [[unlikely]] { return std::errc::no_buffer_space; }
+                std::size_t start = pos_;
+                std::size_t total = 0;
+                for (size_type i = 0; i < rows; ++i) {
+                    size_type len = 0;
+                    if ((code = read_size(len)) != std::errc{}) [[unlikely]] { return code; }
+                    if (len > (size_ - pos_) / sizeof(element_type)) [[unlikely]] { return std::errc::no_buffer_space; }
+                    pos_ += len * sizeof(element_type);
+                    total += len;
+                }
+                if constexpr (NotSkip) {
+                    if (!charge(total * sizeof(element_type) + (std::size_t{ rows } + 1) * sizeof(std::size_t))) [[unlikely]] {
+                        return std::errc::not_enough_memory;
+                    }
+                    auto& values = item.values_;
+                    auto& offsets = item.offsets_;
+                    values.resize(total);
+                    offsets.resize(std::size_t{ rows } + 1);
+                    std::size_t p = start;
+                    std::size_t filled = 0;
+                    offsets[0] = 0;
+                    for (size_type i = 0; i < rows; ++i) {
+                        size_type len = 0;
+                        std::memcpy(&len, data_ + p, sizeof(size_type));
+                        p += sizeof(size_type);
+                        if (len) { std::memcpy(values.data() + filled, data_ + p, len * sizeof(element_type)); }
+                        p += len * sizeof(element_type);
+                        filled += len;
+                        offsets[i + 1] = filled;
+                    }
+                }
+                return {};
+            }
+
+            // 节点式容器 (map/set 等) 每个元素额外占用的内存估算值
+            static constexpr std::size_t node_overhead = 4 * sizeof(void*);
+
+            DMPACK_INLINE bool charge(std::size_t bytes) {
+                if (bytes > budget_) [[unlikely]] { return false; }
+                budget_ -= bytes;
+                return true;
+            }
+
+            DMPACK_INLINE std::errc read_size(size_type& container_size) {
+                if (pos_ + sizeof(size_type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                std::memcpy(&container_size, data_ + pos_, sizeof(size_type));
+                pos_ += sizeof(size_type);
+                return {};
+            }
+
+            // bounded 容器: 线上的元素个数不得超过声明的上限，检查后仍按原容器解码
+            DMPACK_INLINE std::errc check_bound(std::size_t max_length) const {
+                if (pos_ + sizeof(size_type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                size_type container_size = 0;
+                std::memcpy(&container_size, data_ + pos_, sizeof(size_type));
+                return container_size > max_length ? std::errc::invalid_argument : std::errc{};
+            }
+
+            // 元素个数必须能被剩余字节容纳，伪造的长度在遍历之前就被拒绝
+            template <typename T>
+            DMPACK_INLINE bool count_fits(std::size_t count) const {
+                constexpr std::size_t min_size = min_wire_size<T>();
+                if constexpr (min_size == 0) { return true; }
+                else { return count <= (size_ - pos_) / min_size; }
+            }
+
+            DMPACK_INLINE std::errc read_flag(bool& flag) {
+                if (pos_ + sizeof(bool) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                uint8_t byte = static_cast<uint8_t>(data_[pos_]);
+                if (byte > 1) [[unlikely]] { return std::errc::invalid_argument; }
+                flag = byte != 0;
+                pos_ += sizeof(bool);
+                return {};
+            }
+
+            template <typename Tuple, bool Validate, std::size_t... I>
+            DMPACK_INLINE std::errc skip_tuple(std::size_t depth, std::index_sequence<I...>) {
+                std::errc code{};
+                (((code = skip_one<std::tuple_element_t<I, Tuple>, Validate>(depth)) == std::errc{}) && ...);
+                return code;
+            }
+
+            template <typename Variant, bool Validate, std::size_t... I>
+            DMPACK_INLINE std::errc skip_variant(uint32_t index, std::size_t depth, std::index_sequence<I...>) {
+                std::errc code{};
+                ((index == I ? (code = skip_one<std::variant_alternative_t<I, Variant>, Validate>(depth), true) : false) || ...);
+                return code;
+            }
+
+            // 按类型跳过一个值，只读长度头，不构造任何对象。
+            // Validate 为 true 时同时检查 bool/枚举取值并完整走一遍 xor 位流
+            template <typename T, bool Validate>
+            std::errc skip_one(std::size_t depth) {
+                using type = dm_remove_cvref_t<T>;
+                if (depth > DMPACK_MAX_DEPTH) [[unlikely]] { return std::errc::invalid_argument; }
+                std::errc code{};
+                if constexpr (dm_is_monostate_v<type>) {}
+                else if constexpr (dm_pack_is_bounded_v<type>) {
+                    if ((code = check_bound(type::max_length)) != std::errc{}) [[unlikely]] { return code; }
+                    code = skip_one<typename type::base, Validate>(depth);
+                }
+                else if constexpr (dm_is_fundamental_v<type> || dm_is_enum_v<type>) {
+                    if (pos_ + sizeof(type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if constexpr (Validate) {
+                        if (!values_in_range<type>(data_ + pos_, 1)) [[unlikely]] { return std::errc::invalid_argument; }
+                    }
+                    pos_ += sizeof(type);
+                }
+                else if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) {
+                    using value_type = dm_remove_cvref_t<dm_element_type_t<type>>;
+                    constexpr auto sz = dm_get_array_size_v<type>;
+                    if constexpr (dm_pack_raw_v<type>) {
+                        if (pos_ + sizeof(type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                        if constexpr (Validate) {
+                            if (!values_in_range<value_type>(data_ + pos_, sz)) [[unlikely]] { return std::errc::invalid_argument; }
+                        }
+                        pos_ += sizeof(type);
+                    }
+                    else {
+                        for (std::size_t i = 0; i < sz; ++i) {
+                            code = skip_one<value_type, Validate>(depth + 1);
+                            if (code != std::errc{}) [[unlikely]] { return code; }
+                        }
+                    }
+                }
+                else if constexpr (dm_pack_is_delta_vector_v<type>) {
+                    size_type container_size = 0;
+                    if ((code = read_size(container_size)) != std::errc{}) [[unlikely]] { return code; }
+                    std::size_t consumed = 0;
+                    code = delta_decode(data_ + pos_, size_ - pos_, container_size,
+                        static_cast<typename type::value_type*>(nullptr), consumed);
+                    pos_ += consumed;
+                }
+                else if constexpr (dm_pack_is_xor_vector_v<type>) {
+                    size_type container_size = 0;
+                    size_type encoded_size = 0;
+                    if ((code = read_size(container_size)) != std::errc{}) [[unlikely]] { return code; }
+                    if ((code = read_size(encoded_size)) != std::errc{}) [[unlikely]] { return code; }
+                    if (pos_ + encoded_size > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    // 每个值至少占 1 位
+                    if (container_size > static_cast<std::size_t>(encoded_size) * 8) [[unlikely]] { return std::errc::invalid_argument; }
+                    if constexpr (Validate) {
+                        xor_decoder<typename type::value_type, Byte> decoder(data_ + pos_, encoded_size);
+                        for (std::size_t i = 0; i < container_size; ++i) { decoder.next(); }
+                        if (decoder.error()) [[unlikely]] { return std::errc::invalid_argument; }
+                    }
+                    pos_ += encoded_size;
+                }
+                else if constexpr (dm_pack_is_bool_vector_v<type>) {
+                    size_type container_size = 0;
+                    if ((code = read_size(container_size)) != std::errc{}) [[unlikely]] { return code; }
+                    std::size_t mem_sz = bits_encoded_size(container_size);
+                    if (pos_ + mem_sz > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    pos_ += mem_sz;
+                }
+                else if constexpr (dm_pack_is_bitset_v<type>) {
+                    constexpr std::size_t mem_sz = min_wire_size<type>();
+                    if (pos_ + mem_sz > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    pos_ += mem_sz;
+                }
+                else if constexpr (dm_pack_is_shared_ptr_v<type>) {
+                    using value_type = dm_remove_cv_t<typename type::element_type>;
+                    uint32_t tag = 0;
+                    if (pos_ + sizeof(uint32_t) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(&tag, data_ + pos_, sizeof(uint32_t));
+                    pos_ += sizeof(uint32_t);
+                    if (tag == ref_inline) {
+                        ref_register(nullptr, ref_type_of<value_type>());
+                        code = skip_one<value_type, Validate>(depth + 1);
+                    }
+                    else if (tag != ref_null) { code = ref_resolve(tag, ref_type_of<value_type>(), nullptr); }
+                }
+                else if constexpr (dm_pack_is_unique_ptr_v<type>) {
+                    bool has_value = false;
+                    if ((code = read_flag(has_value)) != std::errc{}) [[unlikely]] { return code; }
+                    if (has_value) { code = skip_one<typename type::element_type, Validate>(depth + 1); }
+                }
+                else if constexpr (dm_pack_is_flat_table_v<type>) {
+                    // 线上与 vector<vector<T>> 相同 (string_table 的每行即字符串)
+                    code = skip_one<std::vector<std::vector<typename type::element_type>>, Validate>(depth);
+                }
+                else if constexpr (dm_pack_is_split_v<type>) { code = skip_one<std::vector<typename type::value_type>, Validate>(depth); }
+                else if constexpr (dm_is_map_container_v<type>) {
+                    using key_type = typename type::key_type;
+                    using value_type = typename type::mapped_type;
+                    size_type container_size = 0;
+                    if ((code = read_size(container_size)) != std::errc{}) [[unlikely]] { return code; }
+                    if (!count_fits<std::pair<key_type, value_type>>(container_size)) [[unlikely]] { return std::errc::no_buffer_space; }
+                    for (std::size_t i = 0; i < container_size; ++i) {
+                        if ((code = skip_one<key_type, Validate>(depth + 1)) != std::errc{}) [[unlikely]] { return code; }
+                        if ((code = skip_one<value_type, Validate>(depth + 1)) != std::errc{}) [[unlikely]] { return code; }
+                    }
+                }
+                else if constexpr (dm_is_container_v<type>) {
+                    using value_type = dm_remove_cvref_t<typename type::value_type>;
+                    size_type container_size = 0;
+                    if ((code = read_size(container_size)) != std::errc{}) [[unlikely]] { return code; }
+                    if constexpr (dm_pack_raw_container_v<type> && !dm_is_set_container_v<type>) {
+                        std::size_t mem_sz = container_size * sizeof(value_type);
+                        if (pos_ + mem_sz > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                        if constexpr (Validate) {
+                            if (!values_in_range<value_type>(data_ + pos_, container_size)) [[unlikely]] { return std::errc::invalid_argument; }
+                        }
+                        pos_ += mem_sz;
+                    }
+                    else {
+                        if (!count_fits<value_type>(container_size)) [[unlikely]] { return std::errc::no_buffer_space; }
+                        for (std::size_t i = 0; i < container_size; ++i) {
+                            if ((code = skip_one<value_type, Validate>(depth + 1)) != std::errc{}) [[unlikely]] { return code; }
+                        }
+                    }
+                }
+                else if constexpr (dm_is_tuple_like_v<type>) {
+                    using types = decltype(get_types(std::declval<type>()));
+                    code = skip_tuple<types, Validate>(depth + 1, dm_make_index_sequence<std::tuple_size_v<types>>());
+                }
+                else if constexpr (dm_is_optional_v<type>) {
+                    bool has_value = false;
+                    if ((code = read_flag(has_value)) != std::errc{}) [[unlikely]] { return code; }
+                    if (has_value) { code = skip_one<typename type::value_type, Validate>(depth + 1); }
+                }
+                else if constexpr (dm_is_variant_v<type>) {
+                    if (pos_ + sizeof(uint32_t) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    uint32_t index = 0;
+                    std::memcpy(&index, data_ + pos_, sizeof(index));
+                    pos_ += sizeof(index);
+                    if (index >= std::variant_size_v<type>) [[unlikely]] { return std::errc::invalid_argument; }
+                    code = skip_variant<type, Validate>(index, depth + 1, dm_make_index_sequence<std::variant_size_v<type>>());
+                }
+                else if constexpr (dm_pack_expected_v<type>) {
+                    bool has_value = false;
+                    if ((code = read_flag(has_value)) != std::errc{}) [[unlikely]] { return code; }
+                    if (has_value) {
+                        if constexpr (!dm_is_void_v<typename type::value_type>) { code = skip_one<typename type::value_type, Validate>(depth + 1); }
+                    }
+                    else { code = skip_one<typename type::error_type, Validate>(depth + 1); }
+                }
+                else if constexpr (dm_is_class_v<type>) {
+                    static_assert(dm_is_aggregate_v<type>);
+                    if constexpr (dm_pack_raw_v<type>) {
+                        if (pos_ + sizeof(type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                        pos_ += sizeof(type);
+                    }
                     else {
-                        visit_members(item, [this](auto &&...items) DMPACK_CONSTEXPR_INLINE_LAMBDA{ this->template deserialize_many<NotSkip>(items...); });
+                        using types = decltype(get_types(std::declval<type>()));
+                        code = skip_tuple<types, Validate>(depth + 1, dm_make_index_sequence<std::tuple_size_v<types>>());
                     }
                 }
                 else { static_assert(!sizeof(type), "the type is not supported yet"); }
                 return code;
             }
 
-            template <size_t I, size_t FiledIndex, typename FiledType, typename T>
-            DMPACK_INLINE bool set_value(std::errc& err_code, FiledType& field, T&& t) {
-                if constexpr (FiledIndex == I) {
-                    static_assert(dm_is_same_v<dm_remove_cvref_t<FiledType>, dm_remove_cvref_t<T>>);
-                    err_code = deserialize_one<true>(field);
-                    return true;
+            // 用线上字节直接填充字符串或平凡可拷贝元素的 vector，不经过 resize 的清零
+            template <typename T>
+            DMPACK_INLINE void assign_from_wire(T& item, std::size_t count) {
+                using value_type = typename T::value_type;
+                const Byte* first = data_ + pos_;
+                if constexpr (dm_pack_is_std_basic_string_v<T>) {
+#if defined(__cpp_lib_string_resize_and_overwrite)
+                    // 部分 libstdc++ 版本扩容时传入的 n 是新容量而非 count，这里只使用 count
+                    item.resize_and_overwrite(count, [first, count](value_type* p, std::size_t) {
+                        std::memcpy(p, first, count * sizeof(value_type));
+                        return count;
+                    });
+#else
+                    if constexpr (sizeof(value_type) == 1) { item.assign(reinterpret_cast<const value_type*>(first), count); }
+                    else {
+                        item.resize(count);
+                        std::memcpy(item.data(), first, count * sizeof(value_type));
+                    }
+#endif
                 }
-                err_code = deserialize_one<false>(t);
-                return false;
+                else {
+                    using iterator = unaligned_iterator<value_type, Byte>;
+                    item.assign(iterator(first), iterator(first + count * sizeof(value_type)));
+                }
+            }
+
+            template <typename T, std::size_t... Path, typename Field>
+            DMPACK_INLINE std::errc decode_path(Field& field) {
+                if constexpr (sizeof...(Path) == 0) { return deserialize_one<true>(field); }
+                else { return seek_path<T, Path...>(field); }
             }
 
-            template <size_t FiledIndex, typename FiledType, typename... Args>
-            DMPACK_INLINE constexpr decltype(auto) for_each(FiledType& field, Args &&...items) {
-                bool stop = false;
+            template <typename Tuple, std::size_t... I>
+            DMPACK_INLINE std::errc skip_members(std::index_sequence<I...>) {
                 std::errc code{};
-                using I_SEQ = dm_make_index_sequence<sizeof...(Args)>;
-                auto l = { [&](auto &&... I_items) {
-                  auto ll = {[this, &stop, &code, &field](auto i, auto&& item) {
-                    if (!stop) {
-                      stop = set_value<decltype(i)::value, FiledIndex>(code, field, item);
-                    }
-                  }};
-                  (ll(std::integral_constant<size_t, I_items>{}, items), ...);
-                } };
-                l(I_SEQ{});
+                (void)(((code = skip_one<std::tuple_element_t<I, Tuple>, false>(1)) == std::errc{}) && ...);
                 return code;
             }
 
+            template <typename T, std::size_t I, std::size_t... Rest, typename Field>
+            std::errc seek_path(Field& field) {
+                using type = dm_remove_cvref_t<T>;
+                std::errc code{};
+                if constexpr (dm_pack_path_sequence_v<type>) {
+                    using value_type = dm_remove_cvref_t<dm_element_type_t<type>>;
+                    std::size_t count = 0;
+                    if constexpr (dm_is_c_array_v<type> || dm_is_std_array_v<type>) {
+                        count = dm_get_array_size_v<type>;
+                        static_assert(I < dm_get_array_size_v<type>, "array index out of range");
+                    }
+                    else {
+                        size_type container_size = 0;
+                        if ((code = read_size(container_size)) != std::errc{}) [[unlikely]] { return code; }
+                        if (I >= container_size) [[unlikely]] { return std::errc::result_out_of_range; }
+                        count = container_size;
+                    }
+                    if constexpr (dm_pack_raw_v<value_type> &&
+                        (dm_is_c_array_v<type> || dm_is_std_array_v<type> || dm_pack_raw_container_v<type>)) {
+                        // 元素整块拷贝，直接按偏移定位
+                        if (pos_ + count * sizeof(value_type) > size_) [[unlikely]] { return std::errc::no_buffer_space; }
+                        pos_ += I * sizeof(value_type);
+                    }
+                    else {
+                        for (std::size_t i = 0; i < I; ++i) {
+                            if ((code = skip_one<value_type, false>(1)) != std::errc{}) [[unlikely]] { return code; }
+                        }
+                    }
+                    return decode_path<value_type, Rest...>(field);
+                }
+                else if constexpr (!dm_is_tuple_like_v<type> && dm_pack_raw_v<type>) {
+                    // 整体拷贝的结构体在线上没有逐成员的布局，解出整个对象后再取成员
+                    type obj;
+                    if ((code = deserialize_one<true>(obj)) != std::errc{}) [[unlikely]] { return code; }
+                    field = member_path<I, Rest...>(obj);
+                    return code;
+                }
+                else {
+                    using types = decltype(get_types(std::declval<type>()));
+                    if ((code = skip_members<types>(dm_make_index_sequence<I>())) != std::errc{}) [[unlikely]] { return code; }
+                    return decode_path<std::tuple_element_t<I, types>, Rest...>(field);
+                }
+            }
+
             const Byte* data_;
             std::size_t size_;
             std::size_t pos_{};
+            std::size_t budget_ = (std::numeric_limits<std::size_t>::max)();
+            std::size_t pointee_depth_ = 0;
+        };
+
+        //-----------------------------------------------------------------------------
+        // 表驱动的紧凑编解码
+        //
+        // 结构体内声明 using codec_t = dm::pack::compact_codec; 后，该类型不再为每个成员展开
+        // serialize_one/deserialize_one，而是在首次使用时生成一张成员表，由几个不内联的解释器执行:
+        //   raw    : 按偏移整段 memcpy (基础类型、平凡可拷贝的数组与结构体)，相邻且无填充的成员合并为一段
+        //   nested : 同样选择了紧凑编解码的结构体，递归执行它的表
+        //   call   : 其余类型 (字符串、容器等) 经由按成员类型实例化的函数指针处理，各消息类型共享
+        // 线上格式与默认编解码完全相同，两种方式写出的数据可以互相读取。
+        //-----------------------------------------------------------------------------
+        enum class compact_opcode : uint8_t { raw, nested, call };
+
+        struct compact_op {
+            compact_opcode code;
+            uint32_t offset;
+            uint32_t size;                                   // raw 段的字节数
+            const compact_layout* nested;
+            const compact_layout& (*nested_of)();
+            std::size_t (*measure)(const void*);
+            std::size_t (*pack)(const void*, char*);
+            std::errc (*unpack)(void*, unpacker<char>&);
+        };
+
+        struct compact_layout {
+            const compact_op* ops;
+            std::size_t count;
+            std::size_t raw_size;                            // 全部 raw 段的字节数之和
+        };
+
+        template <typename U>
+        struct compact_thunks {
+            static std::size_t measure(const void* obj) { return calculate_one_size(*static_cast<const U*>(obj)); }
+
+            static std::size_t pack(const void* obj, char* out) {
+                packer<char> o(out);
+                o.serialize_one(*static_cast<const U*>(obj));
+                return o.size();
+            }
+
+            static std::errc unpack(void* obj, unpacker<char>& in) { return in.deserialize_one(*static_cast<U*>(obj)); }
+        };
+
+        // 成员类型对应的表项，偏移在运行期补上
+        template <typename U>
+        constexpr compact_op compact_member_op() {
+            using type = dm_remove_cvref_t<U>;
+            constexpr type_id id = get_type_id<type>();
+            // 与 serialize_one 中整块 memcpy 的分支一致
+            if constexpr (dm_is_fundamental_v<type> || dm_is_enum_v<type> ||
+                (dm_pack_raw_v<type> && (id == type_id::array_t || (id == type_id::aggregate_class_t && !dm_is_tuple_like_v<type>)))) {
+                return { compact_opcode::raw, 0, sizeof(type), nullptr, nullptr, nullptr, nullptr, nullptr };
+            }
+            else if constexpr (dm_pack_use_compact_v<type>) {
+                return { compact_opcode::nested, 0, 0, nullptr, &compact_layout_of<type>, nullptr, nullptr, nullptr };
+            }
+            else {
+                return { compact_opcode::call, 0, 0, nullptr, nullptr,
+                    &compact_thunks<type>::measure, &compact_thunks<type>::pack, &compact_thunks<type>::unpack };
+            }
+        }
+
+        template <typename Types, std::size_t... I>
+        constexpr std::array<compact_op, sizeof...(I)> compact_member_ops(std::index_sequence<I...>) {
+            return { compact_member_op<std::tuple_element_t<I, Types>>()... };
+        }
+
+        // 填入偏移并合并相邻且无填充的 raw 段，所有类型共用
+        inline compact_layout compact_build(const compact_op* proto, const uint32_t* offsets, std::size_t n, compact_op* ops) {
+            std::size_t count = 0;
+            std::size_t raw_size = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                compact_op op = proto[i];
+                op.offset = offsets[i];
+                if (op.code == compact_opcode::raw) {
+                    raw_size += op.size;
+                    compact_op* last = count ? &ops[count - 1] : nullptr;
+                    if (last && last->code == compact_opcode::raw && last->offset + last->size == op.offset) {
+                        last->size += op.size;
+                        continue;
+                    }
+                }
+                else if (op.code == compact_opcode::nested) { op.nested = &op.nested_of(); }
+                ops[count++] = op;
+            }
+            return { ops, count, raw_size };
+        }
+
+        template <typename T>
+        struct compact_layout_storage {
+            using types = decltype(get_types(std::declval<T>()));
+            static constexpr std::size_t member_count = std::tuple_size_v<types>;
+
+            std::array<compact_op, member_count> ops{};
+            compact_layout layout{};
+
+            // 成员偏移取自一个默认构造的对象，解码本来就要求 T 可默认构造
+            compact_layout_storage() {
+                static constexpr auto proto = compact_member_ops<types>(std::make_index_sequence<member_count>());
+                std::array<uint32_t, member_count> offsets{};
+                T obj{};
+                const char* base = reinterpret_cast<const char*>(&obj);
+                visit_members(obj, [&](auto&... members) {
+                    std::size_t i = 0;
+                    ((offsets[i++] = static_cast<uint32_t>(reinterpret_cast<const char*>(&members) - base)), ...);
+                });
+                layout = compact_build(proto.data(), offsets.data(), member_count, ops.data());
+            }
         };
 
+        template <typename T>
+        const compact_layout& compact_layout_of() {
+            static const compact_layout_storage<T> storage;
+            return storage.layout;
+        }
+
+        DMPACK_NOINLINE std::size_t compact_measure(const compact_layout& layout, const void* obj) {
+            const char* base = static_cast<const char*>(obj);
+            std::size_t total = layout.raw_size;
+            for (std::size_t i = 0; i < layout.count; ++i) {
+                const compact_op& op = layout.ops[i];
+                if (op.code == compact_opcode::nested) { total += compact_measure(*op.nested, base + op.offset); }
+                else if (op.code == compact_opcode::call) { total += op.measure(base + op.offset); }
+            }
+            return total;
+        }
+
+        DMPACK_NOINLINE std::size_t compact_pack(const compact_layout& layout, const void* obj, char* out) {
+            const char* base = static_cast<const char*>(obj);
+            std::size_t pos = 0;
+            for (std::size_t i = 0; i < layout.count; ++i) {
+                const compact_op& op = layout.ops[i];
+                switch (op.code) {
+                case compact_opcode::raw:
+                    std::memcpy(out + pos, base + op.offset, op.size);
+                    pos += op.size;
+                    break;
+                case compact_opcode::nested:
+                    pos += compact_pack(*op.nested, base + op.offset, out + pos);
+                    break;
+                case compact_opcode::call:
+                    pos += op.pack(base + op.offset, out + pos);
+                    break;
+                }
+            }
+            return pos;
+        }
+
+        DMPACK_NOINLINE std::errc compact_unpack(const compact_layout& layout, void* obj, unpacker<char>& in) {
+            char* base = static_cast<char*>(obj);
+            std::errc code{};
+            for (std::size_t i = 0; i < layout.count && code == std::errc{}; ++i) {
+                const compact_op& op = layout.ops[i];
+                switch (op.code) {
+                case compact_opcode::raw:
+                    if (op.size > in.size_ - in.pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(base + op.offset, in.data_ + in.pos_, op.size);
+                    in.pos_ += op.size;
+                    break;
+                case compact_opcode::nested:
+                    code = compact_unpack(*op.nested, base + op.offset, in);
+                    break;
+                case compact_opcode::call:
+                    code = op.unpack(base + op.offset, in);
+                    break;
+                }
+            }
+            return code;
+        }
 
     }
 }
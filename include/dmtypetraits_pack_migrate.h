@@ -0,0 +1,791 @@
+#ifndef __DMTYPETRAITS_PACK_MIGRATE_H_INCLUDE__
+#define __DMTYPETRAITS_PACK_MIGRATE_H_INCLUDE__
+
+#include "dmtypetraits_pack.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dm::pack {
+    namespace detail {
+
+        //-----------------------------------------------------------------------------
+        // 旧版本数据的迁移解码
+        //
+        // 旧类型的描述串 (get_type_literal<T>()) 先被解析成一棵 schema_node 树，再与当前类型逐层
+        // 比对生成解码计划: 完全相同的子树直接交给 unpacker 的原生路径，其余按旧布局逐节点读取、
+        // 转换后写入新字段，旧类型中已删除的字段按描述串跳过。
+        //
+        // 平凡可拷贝的结构体与数组在线上整块 memcpy 存放，其成员偏移按 C++ 布局规则
+        // (自然对齐) 从描述串推算；布局无法推算的成员 (variant、bitset) 只有在类型未变时才能读取。
+        //-----------------------------------------------------------------------------
+        struct schema_node {
+            type_id id = type_id::compatible_t;
+            uint64_t extent = 0;                  // array/bitset 的元素个数，enclosing_t 指回的外层结构体层数
+            std::size_t literal_pos = 0;          // 本节点在描述串中的位置
+            std::size_t literal_len = 0;
+            std::vector<schema_node> children;
+
+            bool trivial = false;                 // 旧类型是否平凡可拷贝
+            bool layout_known = false;            // size/align/offsets 是否有效
+            bool raw = false;                     // 线上是否为整块的 C++ 对象
+            std::size_t size = 0;
+            std::size_t align = 1;
+            std::size_t min_wire = 0;             // 线上至少占用的字节数
+            std::vector<std::size_t> offsets;     // 结构体各成员的偏移
+
+            bool same = false;                    // 与当前类型完全一致
+            std::vector<int> field_map;           // 旧成员下标 -> 新成员下标，-1 表示已删除
+        };
+
+        // 描述串来自输入时可能被伪造，推算出的大小超过此值即视为非法
+        constexpr std::size_t schema_size_limit = (std::numeric_limits<std::size_t>::max)() >> 2;
+
+        DMPACK_INLINE std::size_t scalar_wire_size(type_id id) {
+            switch (id) {
+            case type_id::int8_t: case type_id::uint8_t: case type_id::bool_t: case type_id::char_8_t:
+                return 1;
+            case type_id::int16_t: case type_id::uint16_t: case type_id::char_16_t: case type_id::float16_t:
+                return 2;
+            case type_id::int32_t: case type_id::uint32_t: case type_id::char_32_t: case type_id::float32_t:
+                return 4;
+            case type_id::int64_t: case type_id::uint64_t: case type_id::float64_t:
+                return 8;
+            case type_id::int128_t: case type_id::uint128_t: case type_id::float128_t:
+                return 16;
+            case type_id::w_char_t:
+                return sizeof(wchar_t);
+            default:
+                return 0;
+            }
+        }
+
+        // 1: 有符号整数  2: 无符号整数 (含 bool)  3: 浮点  0: 其它
+        DMPACK_INLINE int scalar_kind(type_id id) {
+            switch (id) {
+            case type_id::int8_t: case type_id::int16_t: case type_id::int32_t: case type_id::int64_t:
+                return 1;
+            case type_id::uint8_t: case type_id::uint16_t: case type_id::uint32_t: case type_id::uint64_t: case type_id::bool_t:
+                return 2;
+            case type_id::float32_t: case type_id::float64_t:
+                return 3;
+            default:
+                return 0;
+            }
+        }
+
+        // 旧标量能否无损地转换为新标量: 整数加宽、无符号转更宽的有符号、整数转尾数足够宽的浮点、float 转 double
+        DMPACK_INLINE bool scalar_widens(type_id from, type_id to) {
+            if (from == to) { return scalar_wire_size(from) != 0; }
+            int from_kind = scalar_kind(from);
+            int to_kind = scalar_kind(to);
+            std::size_t from_size = scalar_wire_size(from);
+            std::size_t to_size = scalar_wire_size(to);
+            if (from_kind == 0 || to_kind == 0) { return false; }
+            if (to_kind == 3) { return from_kind == 3 ? from_size < to_size : from_size * 2 <= to_size; }
+            if (from_kind == 3) { return false; }
+            if (to_kind == 2) { return from_kind == 2 && from_size < to_size; }
+            return from_size < to_size;
+        }
+
+        template <typename U, typename Byte>
+        DMPACK_INLINE void load_scalar(U& out, type_id id, const Byte* p) {
+            auto load = [&](auto v) {
+                std::memcpy(&v, p, sizeof(v));
+                out = static_cast<U>(v);
+            };
+            switch (id) {
+            case type_id::int8_t: load(int8_t{}); break;
+            case type_id::uint8_t: load(uint8_t{}); break;
+            case type_id::int16_t: load(int16_t{}); break;
+            case type_id::uint16_t: load(uint16_t{}); break;
+            case type_id::int32_t: load(int32_t{}); break;
+            case type_id::uint32_t: load(uint32_t{}); break;
+            case type_id::int64_t: load(int64_t{}); break;
+            case type_id::uint64_t: load(uint64_t{}); break;
+            case type_id::float32_t: load(float{}); break;
+            case type_id::float64_t: load(double{}); break;
+            case type_id::bool_t: out = static_cast<U>(static_cast<uint8_t>(p[0]) != 0); break;
+            default: break;
+            }
+        }
+
+        DMPACK_INLINE std::size_t align_up(std::size_t n, std::size_t align) {
+            return (n + align - 1) / align * align;
+        }
+
+        DMPACK_INLINE std::size_t saturating_add(std::size_t a, std::size_t b) {
+            return a > schema_size_limit - b ? schema_size_limit : a + b;
+        }
+
+        DMPACK_INLINE std::size_t saturating_mul(std::size_t a, std::size_t b) {
+            return (b != 0 && a > schema_size_limit / b) ? schema_size_limit : a * b;
+        }
+
+        // 按 C++ 布局规则推算旧类型的大小、对齐与成员偏移，并求线上最小长度
+        DMPACK_INLINE std::errc compute_layout(schema_node& node) {
+            switch (node.id) {
+            case type_id::string_t: case type_id::container_t: case type_id::set_container_t:
+            case type_id::map_container_t: case type_id::delta_container_t: case type_id::bit_container_t:
+                node.min_wire = sizeof(size_type);
+                break;
+            case type_id::xor_container_t:
+                node.min_wire = 2 * sizeof(size_type);
+                break;
+            case type_id::shared_ptr_t:
+                node.min_wire = sizeof(uint32_t);
+                break;
+            case type_id::unique_ptr_t:
+                node.min_wire = sizeof(bool);
+                break;
+            case type_id::enclosing_t:
+                // 只出现在智能指针之下，线上长度由指针节点给出
+                break;
+            case type_id::bitset_t:
+                node.trivial = true;
+                node.min_wire = bits_encoded_size(node.extent);
+                break;
+            case type_id::monostate_t:
+                node.trivial = node.layout_known = true;
+                node.size = node.align = 1;
+                break;
+            case type_id::array_t: {
+                const schema_node& elem = node.children[0];
+                node.trivial = node.raw = elem.trivial;
+                if (elem.layout_known) {
+                    if (elem.size != 0 && node.extent > schema_size_limit / elem.size) [[unlikely]] { return std::errc::invalid_argument; }
+                    node.layout_known = true;
+                    node.size = elem.size * node.extent;
+                    node.align = elem.align;
+                }
+                node.min_wire = saturating_mul(elem.min_wire, node.extent);
+                break;
+            }
+            case type_id::optional_t: {
+                const schema_node& value = node.children[0];
+                node.trivial = value.trivial;
+                if (value.layout_known) {
+                    node.layout_known = true;
+                    node.align = value.align;
+                    node.size = align_up(value.size + sizeof(bool), value.align);
+                }
+                node.min_wire = sizeof(bool);
+                break;
+            }
+            case type_id::expected_t:
+                node.min_wire = sizeof(bool) + (std::min)(node.children[0].min_wire, node.children[1].min_wire);
+                break;
+            case type_id::variant_t: {
+                node.trivial = true;
+                std::size_t min_alt = schema_size_limit;
+                for (const auto& alt : node.children) {
+                    node.trivial = node.trivial && alt.trivial;
+                    min_alt = (std::min)(min_alt, alt.min_wire);
+                }
+                node.min_wire = sizeof(uint32_t) + min_alt;
+                break;
+            }
+            case type_id::aggregate_class_t: case type_id::packed_class_t: {
+                node.trivial = node.layout_known = true;
+                std::size_t offset = 0;
+                std::size_t min_wire = 0;
+                for (const auto& member : node.children) {
+                    node.trivial = node.trivial && member.trivial;
+                    node.layout_known = node.layout_known && member.layout_known;
+                    min_wire = saturating_add(min_wire, member.min_wire);
+                    if (!node.layout_known) { continue; }
+                    node.align = (std::max)(node.align, member.align);
+                    offset = align_up(offset, member.align);
+                    node.offsets.push_back(offset);
+                    if (member.size > schema_size_limit - offset) [[unlikely]] { return std::errc::invalid_argument; }
+                    offset += member.size;
+                }
+                if (node.layout_known) { node.size = node.children.empty() ? 1 : align_up(offset, node.align); }
+                // 去除了填充的结构体逐成员存放，包含它的对象也不再整块存放
+                if (node.id == type_id::packed_class_t) { node.trivial = false; }
+                node.raw = node.trivial;
+                node.min_wire = node.raw ? node.size : min_wire;
+                break;
+            }
+            default:
+                node.trivial = node.layout_known = node.raw = true;
+                node.size = node.align = node.min_wire = scalar_wire_size(node.id);
+                break;
+            }
+            if (node.raw && node.layout_known) { node.min_wire = node.size; }
+            return {};
+        }
+
+        // 解析 detail::get_type_literal 生成的描述串，语法与其一一对应
+        class schema_parser {
+        public:
+            explicit schema_parser(std::string_view literal) : literal_(literal) {}
+
+            // 顶层为若干个连续的节点，直到串尾
+            DMPACK_INLINE std::errc parse_all(std::vector<schema_node>& nodes) {
+                while (pos_ < literal_.size()) {
+                    std::errc code = parse(nodes.emplace_back(), 0);
+                    if (code != std::errc{}) [[unlikely]] { return code; }
+                }
+                return {};
+            }
+
+        private:
+            inline std::errc parse(schema_node& node, std::size_t depth) {
+                if (depth > DMPACK_MAX_DEPTH || pos_ >= literal_.size()) [[unlikely]] { return std::errc::invalid_argument; }
+                node.literal_pos = pos_;
+                node.id = static_cast<type_id>(static_cast<uint8_t>(literal_[pos_++]));
+                std::errc code{};
+                switch (node.id) {
+                case type_id::string_t: case type_id::container_t: case type_id::set_container_t:
+                case type_id::optional_t: case type_id::delta_container_t: case type_id::xor_container_t:
+                case type_id::shared_ptr_t: case type_id::unique_ptr_t:
+                    code = parse_children(node, 1, depth);
+                    break;
+                case type_id::map_container_t: case type_id::expected_t:
+                    code = parse_children(node, 2, depth);
+                    break;
+                case type_id::array_t:
+                    code = parse_children(node, 1, depth);
+                    if (code == std::errc{}) { code = parse_extent(node); }
+                    break;
+                case type_id::bitset_t:
+                    code = parse_extent(node);
+                    break;
+                case type_id::bit_container_t: case type_id::monostate_t:
+                    break;
+                case type_id::enclosing_t:
+                    if (pos_ >= literal_.size()) [[unlikely]] { return std::errc::invalid_argument; }
+                    node.extent = static_cast<uint8_t>(literal_[pos_++]);
+                    if (node.extent == 0 || node.extent > classes_) [[unlikely]] { return std::errc::invalid_argument; }
+                    break;
+                case type_id::variant_t: case type_id::aggregate_class_t: case type_id::packed_class_t: {
+                    bool is_class = node.id != type_id::variant_t;
+                    classes_ += is_class;
+                    while (code == std::errc{}) {
+                        if (pos_ >= literal_.size()) [[unlikely]] { return std::errc::invalid_argument; }
+                        if (static_cast<uint8_t>(literal_[pos_]) == static_cast<uint8_t>(type_id::type_end_flag)) { ++pos_; break; }
+                        code = parse(node.children.emplace_back(), depth + 1);
+                    }
+                    classes_ -= is_class;
+                    if (node.id == type_id::variant_t && node.children.empty()) [[unlikely]] { return std::errc::invalid_argument; }
+                    break;
+                }
+                default:
+                    if (scalar_wire_size(node.id) == 0) [[unlikely]] { return std::errc::invalid_argument; }
+                    break;
+                }
+                if (code != std::errc{}) [[unlikely]] { return code; }
+                node.literal_len = pos_ - node.literal_pos;
+                return compute_layout(node);
+            }
+
+            inline std::errc parse_children(schema_node& node, std::size_t count, std::size_t depth) {
+                node.children.resize(count);
+                for (auto& child : node.children) {
+                    std::errc code = parse(child, depth + 1);
+                    if (code != std::errc{}) [[unlikely]] { return code; }
+                }
+                return {};
+            }
+
+            // 8 字节大端序的元素个数，见 get_size_literal
+            DMPACK_INLINE std::errc parse_extent(schema_node& node) {
+                if (literal_.size() - pos_ < 8) [[unlikely]] { return std::errc::invalid_argument; }
+                uint64_t extent = 0;
+                for (int i = 0; i < 8; ++i) { extent = (extent << 8) | static_cast<uint8_t>(literal_[pos_++]); }
+                if (extent > MAX_SIZE) [[unlikely]] { return std::errc::invalid_argument; }
+                node.extent = extent;
+                return {};
+            }
+
+            std::string_view literal_;
+            std::size_t pos_ = 0;
+            std::size_t classes_ = 0;             // 正在解析的外层结构体层数
+        };
+
+        // 已删除的字段只需跳过，整块存放的部分需要已知大小 (递归函数不能强制内联)
+        // 指回外层结构体的递归指针不支持跳过
+        inline std::errc check_skippable(const schema_node& node) {
+            if (node.id == type_id::enclosing_t) { return std::errc::not_supported; }
+            if (node.raw) { return node.layout_known ? std::errc{} : std::errc::not_supported; }
+            for (const auto& child : node.children) {
+                std::errc code = check_skippable(child);
+                if (code != std::errc{}) { return code; }
+            }
+            return {};
+        }
+
+        template <typename Types, typename F, std::size_t... I>
+        DMPACK_INLINE std::errc visit_type_at(int index, F&& f, std::index_sequence<I...>) {
+            std::errc code = std::errc::invalid_argument;
+            ((static_cast<int>(I) == index ? (void)(code = f(type_tag<dm_remove_cvref_t<std::tuple_element_t<I, Types>>>{})) : (void)0), ...);
+            return code;
+        }
+
+        template <typename U>
+        std::errc bind_schema(schema_node& node, std::string_view literal, bool in_raw);
+
+        template <typename Variant, std::size_t... I>
+        DMPACK_INLINE std::errc bind_alternatives(schema_node& node, std::string_view literal, std::index_sequence<I...>) {
+            std::errc code{};
+            (((code = I < node.children.size() ? bind_schema<std::variant_alternative_t<I, Variant>>(node.children[I], literal, false) : std::errc{}) == std::errc{}) && ...);
+            return code;
+        }
+
+        // 在旧节点与当前类型结构不同的情况下生成解码计划，in_raw 表示节点位于整块存放的对象内部
+        template <typename U>
+        DMPACK_INLINE std::errc bind_structure(schema_node& node, std::string_view literal, bool in_raw) {
+            using type = dm_remove_cvref_t<U>;
+            constexpr type_id id = get_type_id<type>();
+            if (in_raw && !node.layout_known) { return std::errc::not_supported; }
+            // string_table/jagged/split 只支持类型不变
+            if constexpr (dm_pack_is_flat_table_v<type> || dm_pack_is_split_v<type>) { return std::errc::not_supported; }
+            else if constexpr (dm_is_fundamental_v<type> || dm_is_enum_v<type>) {
+                return scalar_widens(node.id, id) ? std::errc{} : std::errc::not_supported;
+            }
+            else if constexpr (id == type_id::delta_container_t) {
+                if (node.id != id) { return std::errc::not_supported; }
+                return scalar_widens(node.children[0].id, get_type_id<typename type::value_type>()) ? std::errc{} : std::errc::not_supported;
+            }
+            else if constexpr (id == type_id::array_t) {
+                if (node.id != id || (node.raw && !node.layout_known)) { return std::errc::not_supported; }
+                return bind_schema<dm_element_type_t<type>>(node.children[0], literal, in_raw || node.raw);
+            }
+            else if constexpr (id == type_id::container_t || id == type_id::set_container_t) {
+                if (node.id != id) { return std::errc::not_supported; }
+                return bind_schema<typename type::value_type>(node.children[0], literal, false);
+            }
+            else if constexpr (id == type_id::map_container_t) {
+                if (node.id != id) { return std::errc::not_supported; }
+                std::errc code = bind_schema<typename type::key_type>(node.children[0], literal, false);
+                if (code != std::errc{}) { return code; }
+                return bind_schema<typename type::mapped_type>(node.children[1], literal, false);
+            }
+            else if constexpr (id == type_id::optional_t) {
+                if (node.id != id) { return std::errc::not_supported; }
+                return bind_schema<typename type::value_type>(node.children[0], literal, in_raw);
+            }
+            else if constexpr (id == type_id::variant_t) {
+                if (node.id != id || node.children.size() > std::variant_size_v<type>) { return std::errc::not_supported; }
+                return bind_alternatives<type>(node, literal, std::make_index_sequence<std::variant_size_v<type>>());
+            }
+            else if constexpr (id == type_id::aggregate_class_t || id == type_id::packed_class_t) {
+                using types = decltype(get_types(std::declval<type>()));
+                constexpr std::size_t count = std::tuple_size_v<types>;
+                // 是否去除填充只影响线上布局，两种结构体之间可以互相迁移
+                if (node.id != type_id::aggregate_class_t && node.id != type_id::packed_class_t) { return std::errc::not_supported; }
+                // 描述串不区分结构体与 tuple，以当前类型为准: tuple 不是平凡可拷贝的，从不整块存放
+                if constexpr (dm_is_tuple_like_v<type>) {
+                    if (in_raw) { return std::errc::not_supported; }
+                    node.raw = false;
+                }
+                if (node.raw && !node.layout_known) { return std::errc::not_supported; }
+                if (node.field_map.empty()) {
+                    for (std::size_t i = 0; i < node.children.size(); ++i) { node.field_map.push_back(i < count ? static_cast<int>(i) : -1); }
+                }
+                bool member_raw = in_raw || node.raw;
+                for (std::size_t i = 0; i < node.children.size(); ++i) {
+                    schema_node& child = node.children[i];
+                    std::errc code{};
+                    if (node.field_map[i] < 0) {
+                        if (!member_raw) { code = check_skippable(child); }
+                    }
+                    else {
+                        code = visit_type_at<types>(node.field_map[i], [&](auto tag) {
+                            return bind_schema<typename decltype(tag)::type>(child, literal, member_raw);
+                        }, std::make_index_sequence<count>());
+                    }
+                    if (code != std::errc{}) { return code; }
+                }
+                return {};
+            }
+            else {
+                // string、xor_vector、vector<bool>、bitset、expected 与智能指针只支持类型不变
+                return std::errc::not_supported;
+            }
+        }
+
+        template <typename U>
+        DMPACK_INLINE std::errc bind_schema(schema_node& node, std::string_view literal, bool in_raw) {
+            using type = dm_remove_cvref_t<U>;
+            static constexpr auto current = get_type_literal<type, void>();
+            // 整块对象内部的节点按 memcpy 读取，要求当前类型同样平凡可拷贝
+            if (literal.substr(node.literal_pos, node.literal_len) == std::string_view(current.data(), current.size()) &&
+                (!in_raw || dm_pack_raw_v<type>)) {
+                node.same = true;
+                return {};
+            }
+            return bind_structure<type>(node, literal, in_raw);
+        }
+
+        // new_to_old[j] 为新成员 j 对应的旧成员下标 (-1 表示新增)，转换为旧成员到新成员的映射
+        DMPACK_INLINE std::errc invert_field_map(const std::vector<int>& new_to_old, std::size_t old_count, std::vector<int>& old_to_new) {
+            old_to_new.assign(old_count, -1);
+            for (std::size_t j = 0; j < new_to_old.size(); ++j) {
+                int i = new_to_old[j];
+                if (i < 0) { continue; }
+                if (static_cast<std::size_t>(i) >= old_count || old_to_new[i] >= 0) { return std::errc::invalid_argument; }
+                old_to_new[i] = static_cast<int>(j);
+            }
+            return {};
+        }
+
+        template <typename Byte>
+        class migrate_reader {
+        public:
+            DMPACK_INLINE migrate_reader(const Byte* data, std::size_t size) : in_(data, size) {}
+
+            template <typename T>
+            DMPACK_INLINE std::errc read(T& t, const schema_node& root, uint32_t types_code) {
+                // 旧数据中被删除的字段也可能含 shared_ptr，总是建立编号表
+                ref_scope<true> refs;
+                if (root.same) { return in_.deserialize(t); }
+                if (in_.size_ < sizeof(uint32_t)) [[unlikely]] { return std::errc::no_buffer_space; }
+                uint32_t code{};
+                std::memcpy(&code, in_.data_, sizeof(uint32_t));
+                if (code / 2 != types_code / 2) [[unlikely]] { return std::errc::invalid_argument; }
+                // 含 compatible 字段的数据: 描述串里看不到这些字段，无法迁移
+                if (code % 2) [[unlikely]] { return std::errc::not_supported; }
+                in_.pos_ = sizeof(uint32_t);
+                return read_into(t, root);
+            }
+
+        private:
+            DMPACK_INLINE bool fits(std::size_t count, std::size_t min_wire) const {
+                return min_wire == 0 || count <= (in_.size_ - in_.pos_) / min_wire;
+            }
+
+            template <typename U>
+            DMPACK_INLINE std::errc read_into(U& item, const schema_node& node) {
+                using type = dm_remove_cvref_t<U>;
+                constexpr type_id id = get_type_id<type>();
+                if (node.same) { return in_.deserialize_one(item); }
+                if (node.raw) {
+                    if (node.size > in_.size_ - in_.pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    read_raw(item, node, in_.data_ + in_.pos_);
+                    in_.pos_ += node.size;
+                    return {};
+                }
+                std::errc code{};
+                size_type count = 0;
+                if constexpr (dm_pack_is_flat_table_v<type> || dm_pack_is_split_v<type>) { code = std::errc::not_supported; }
+                else if constexpr (id == type_id::delta_container_t) {
+                    // 差值按 64 位回绕累加，旧元素类型更窄时直接解码到新类型即为加宽后的值
+                    if ((code = in_.read_size(count)) != std::errc{}) [[unlikely]] { return code; }
+                    if (delta_min_encoded_size(count) > in_.size_ - in_.pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if (!in_.charge(count * sizeof(typename type::value_type))) [[unlikely]] { return std::errc::not_enough_memory; }
+                    item.resize(count);
+                    std::size_t consumed = 0;
+                    code = delta_decode(in_.data_ + in_.pos_, in_.size_ - in_.pos_, count, item.data(), consumed);
+                    in_.pos_ += consumed;
+                }
+                else if constexpr (id == type_id::array_t) {
+                    const schema_node& elem = node.children[0];
+                    for (uint64_t i = 0; i < node.extent && code == std::errc{}; ++i) {
+                        code = i < std::size(item) ? read_into(item[i], elem) : skip(elem);
+                    }
+                }
+                else if constexpr (id == type_id::container_t) {
+                    const schema_node& elem = node.children[0];
+                    if ((code = in_.read_size(count)) != std::errc{}) [[unlikely]] { return code; }
+                    if (!fits(count, elem.min_wire)) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if (!in_.charge(count * sizeof(typename type::value_type))) [[unlikely]] { return std::errc::not_enough_memory; }
+                    item.clear();
+                    if constexpr (dm_pack_has_reserve_v<type>) { item.reserve(count); }
+                    for (size_type i = 0; i < count && code == std::errc{}; ++i) { code = read_into(item.emplace_back(), elem); }
+                }
+                else if constexpr (id == type_id::set_container_t) {
+                    const schema_node& elem = node.children[0];
+                    if ((code = in_.read_size(count)) != std::errc{}) [[unlikely]] { return code; }
+                    if (!fits(count, elem.min_wire)) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if (!in_.charge(count * (sizeof(typename type::value_type) + in_.node_overhead))) [[unlikely]] { return std::errc::not_enough_memory; }
+                    item.clear();
+                    for (size_type i = 0; i < count && code == std::errc{}; ++i) {
+                        typename type::value_type value{};
+                        if ((code = read_into(value, elem)) != std::errc{}) [[unlikely]] { return code; }
+                        item.emplace_hint(item.end(), std::move(value));
+                    }
+                }
+                else if constexpr (id == type_id::map_container_t) {
+                    if ((code = in_.read_size(count)) != std::errc{}) [[unlikely]] { return code; }
+                    if (!fits(count, saturating_add(node.children[0].min_wire, node.children[1].min_wire))) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if (!in_.charge(count * (sizeof(typename type::value_type) + in_.node_overhead))) [[unlikely]] { return std::errc::not_enough_memory; }
+                    item.clear();
+                    for (size_type i = 0; i < count && code == std::errc{}; ++i) {
+                        typename type::key_type key{};
+                        if ((code = read_into(key, node.children[0])) != std::errc{}) [[unlikely]] { return code; }
+                        auto it = item.emplace_hint(item.end(), std::piecewise_construct,
+                            std::forward_as_tuple(std::move(key)), std::forward_as_tuple());
+                        code = read_into(it->second, node.children[1]);
+                    }
+                }
+                else if constexpr (id == type_id::optional_t) {
+                    bool has_value{};
+                    if ((code = in_.read_flag(has_value)) != std::errc{}) [[unlikely]] { return code; }
+                    if (!has_value) { item.reset(); return {}; }
+                    if (!item.has_value()) { item.emplace(); }
+                    code = read_into(*item, node.children[0]);
+                }
+                else if constexpr (id == type_id::variant_t) {
+                    uint32_t index = 0;
+                    if (sizeof(uint32_t) > in_.size_ - in_.pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(&index, in_.data_ + in_.pos_, sizeof(uint32_t));
+                    in_.pos_ += sizeof(uint32_t);
+                    if (index >= node.children.size()) [[unlikely]] { return std::errc::invalid_argument; }
+                    code = read_alternative(item, index, node.children[index], std::make_index_sequence<std::variant_size_v<type>>());
+                }
+                else if constexpr (id == type_id::aggregate_class_t || id == type_id::packed_class_t) {
+                    for (std::size_t i = 0; i < node.children.size() && code == std::errc{}; ++i) {
+                        const schema_node& child = node.children[i];
+                        if (node.field_map[i] < 0) { code = skip(child); }
+                        else { code = visit_member_at(item, node.field_map[i], [&](auto& member) { return read_into(member, child); }); }
+                    }
+                }
+                else { code = std::errc::not_supported; }
+                return code;
+            }
+
+            template <typename Variant, std::size_t... I>
+            DMPACK_INLINE std::errc read_alternative(Variant& item, std::size_t index, const schema_node& node, std::index_sequence<I...>) {
+                std::errc code = std::errc::invalid_argument;
+                ((I == index ? (void)(code = read_into(item.template emplace<I>(), node)) : (void)0), ...);
+                return code;
+            }
+
+            // 读取整块存放的旧对象，p 指向其起始处，边界已由调用者检查
+            template <typename U>
+            DMPACK_INLINE void read_raw(U& item, const schema_node& node, const Byte* p) {
+                using type = dm_remove_cvref_t<U>;
+                constexpr type_id id = get_type_id<type>();
+                if constexpr (dm_pack_raw_v<type>) {
+                    if (node.same) { std::memcpy(&item, p, sizeof(type)); return; }
+                }
+                if constexpr (dm_is_fundamental_v<type> || dm_is_enum_v<type>) { load_scalar(item, node.id, p); }
+                else if constexpr (id == type_id::array_t) {
+                    const schema_node& elem = node.children[0];
+                    std::size_t n = (std::min)(static_cast<std::size_t>(node.extent), std::size(item));
+                    for (std::size_t i = 0; i < n; ++i) { read_raw(item[i], elem, p + i * elem.size); }
+                }
+                else if constexpr (id == type_id::optional_t) {
+                    const schema_node& value = node.children[0];
+                    if (static_cast<uint8_t>(p[value.size]) == 0) { item.reset(); return; }
+                    if (!item.has_value()) { item.emplace(); }
+                    read_raw(*item, value, p);
+                }
+                else if constexpr (id == type_id::aggregate_class_t || id == type_id::packed_class_t) {
+                    for (std::size_t i = 0; i < node.children.size(); ++i) {
+                        if (node.field_map[i] < 0) { continue; }
+                        visit_member_at(item, node.field_map[i], [&](auto& member) {
+                            read_raw(member, node.children[i], p + node.offsets[i]);
+                            return std::errc{};
+                        });
+                    }
+                }
+            }
+
+            inline std::errc skip(const schema_node& node) {
+                if (node.raw) {
+                    if (!node.layout_known) [[unlikely]] { return std::errc::not_supported; }
+                    if (node.size > in_.size_ - in_.pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    in_.pos_ += node.size;
+                    return {};
+                }
+                std::errc code{};
+                size_type count = 0;
+                bool flag = false;
+                switch (node.id) {
+                case type_id::string_t: case type_id::container_t: case type_id::set_container_t: case type_id::map_container_t: {
+                    if ((code = in_.read_size(count)) != std::errc{}) [[unlikely]] { return code; }
+                    std::size_t min_wire = 0;
+                    for (const auto& child : node.children) { min_wire = saturating_add(min_wire, child.min_wire); }
+                    if (!fits(count, min_wire)) [[unlikely]] { return std::errc::no_buffer_space; }
+                    if (node.children.size() == 1 && node.children[0].raw) {
+                        in_.pos_ += count * node.children[0].size;
+                        return {};
+                    }
+                    for (size_type i = 0; i < count; ++i) {
+                        for (const auto& child : node.children) {
+                            if ((code = skip(child)) != std::errc{}) [[unlikely]] { return code; }
+                        }
+                    }
+                    return {};
+                }
+                case type_id::delta_container_t: {
+                    if ((code = in_.read_size(count)) != std::errc{}) [[unlikely]] { return code; }
+                    std::size_t consumed = 0;
+                    code = delta_decode(in_.data_ + in_.pos_, in_.size_ - in_.pos_, count, static_cast<uint64_t*>(nullptr), consumed);
+                    in_.pos_ += consumed;
+                    return code;
+                }
+                case type_id::xor_container_t: {
+                    size_type encoded_size = 0;
+                    if ((code = in_.read_size(count)) != std::errc{}) [[unlikely]] { return code; }
+                    if ((code = in_.read_size(encoded_size)) != std::errc{}) [[unlikely]] { return code; }
+                    return skip_bytes(encoded_size);
+                }
+                case type_id::bit_container_t:
+                    if ((code = in_.read_size(count)) != std::errc{}) [[unlikely]] { return code; }
+                    return skip_bytes(bits_encoded_size(count));
+                case type_id::bitset_t:
+                    return skip_bytes(bits_encoded_size(node.extent));
+                case type_id::array_t:
+                    if (!fits(node.extent, node.children[0].min_wire)) [[unlikely]] { return std::errc::no_buffer_space; }
+                    for (uint64_t i = 0; i < node.extent && code == std::errc{}; ++i) { code = skip(node.children[0]); }
+                    return code;
+                case type_id::optional_t: case type_id::unique_ptr_t:
+                    if ((code = in_.read_flag(flag)) != std::errc{}) [[unlikely]] { return code; }
+                    return flag ? skip(node.children[0]) : std::errc{};
+                case type_id::shared_ptr_t: {
+                    // 被删除字段里的对象不构造，但仍占一个编号; 旧描述串中没有当前类型，回引不检查类型
+                    uint32_t tag = 0;
+                    if (sizeof(uint32_t) > in_.size_ - in_.pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(&tag, in_.data_ + in_.pos_, sizeof(uint32_t));
+                    in_.pos_ += sizeof(uint32_t);
+                    if (tag == ref_inline) {
+                        ref_register(nullptr, nullptr);
+                        return skip(node.children[0]);
+                    }
+                    return tag == ref_null ? std::errc{} : ref_resolve(tag, nullptr, nullptr);
+                }
+                case type_id::expected_t:
+                    if ((code = in_.read_flag(flag)) != std::errc{}) [[unlikely]] { return code; }
+                    return skip(node.children[flag ? 0 : 1]);
+                case type_id::variant_t: {
+                    uint32_t index = 0;
+                    if (sizeof(uint32_t) > in_.size_ - in_.pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                    std::memcpy(&index, in_.data_ + in_.pos_, sizeof(uint32_t));
+                    in_.pos_ += sizeof(uint32_t);
+                    if (index >= node.children.size()) [[unlikely]] { return std::errc::invalid_argument; }
+                    return skip(node.children[index]);
+                }
+                case type_id::aggregate_class_t: case type_id::packed_class_t:
+                    for (const auto& child : node.children) {
+                        if ((code = skip(child)) != std::errc{}) [[unlikely]] { return code; }
+                    }
+                    return {};
+                case type_id::monostate_t:
+                    return {};
+                case type_id::enclosing_t:
+                    return std::errc::not_supported;
+                default:
+                    return std::errc::invalid_argument;
+                }
+            }
+
+            DMPACK_INLINE std::errc skip_bytes(std::size_t n) {
+                if (n > in_.size_ - in_.pos_) [[unlikely]] { return std::errc::no_buffer_space; }
+                in_.pos_ += n;
+                return {};
+            }
+
+            unpacker<Byte> in_;
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief 把旧版本类型写出的数据解码为当前类型 T。
+     *
+     * 写入端用 get_type_literal<T>() 取得类型描述串，随文件或数据流保存一次；读取端用它构造 migrator。
+     * 构造时解析描述串并生成旧布局到 T 的映射计划，之后每条数据都按计划解码，类型未变时直接走原生路径。
+     *
+     * 支持: 整数加宽 (无符号可转为更宽的有符号)、整数与 float 转为精度足够的浮点、末尾新增字段 (保留默认值)、
+     * 删除末尾字段、数组长度变化，以及嵌套在容器、optional、variant 中的结构体的同样变化。
+     * 描述串不含字段名，成员按位置对应，因此改名不影响解码；调整顺序或删除中间字段时，
+     * 用 field_map 给出 T 的每个成员对应的旧成员下标 (-1 表示新增)。
+     *
+     * 无法迁移时 error() 返回 std::errc::not_supported，描述串格式错误时返回 std::errc::invalid_argument，
+     * 此后的解码调用都直接返回该错误。
+     */
+    template <typename T>
+    class migrator {
+    public:
+        explicit migrator(std::string_view old_literal, const std::vector<int>& field_map = {})
+            : literal_(old_literal),
+            types_code_(detail::MD5::MD5Hash32Constexpr(literal_.data(), static_cast<uint32_t>(literal_.size()))) {
+            error_ = build(field_map);
+        }
+
+        [[nodiscard]] std::errc error() const { return error_; }
+
+        // 旧类型与 T 完全相同
+        [[nodiscard]] bool identical() const { return root_.same; }
+
+        template <typename View, typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
+        [[nodiscard]] std::errc deserialize_to(T& t, const View& v) const {
+            return deserialize_to(t, v.data(), v.size());
+        }
+
+        template <typename Byte, typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
+        [[nodiscard]] std::errc deserialize_to(T& t, const Byte* data, std::size_t size) const {
+            if (error_ != std::errc{}) [[unlikely]] { return error_; }
+            detail::migrate_reader<Byte> in(data, size);
+            return in.read(t, root_, types_code_);
+        }
+
+        template <typename View, typename = std::enable_if_t<detail::dm_pack_deserialize_view_v<View>>>
+        [[nodiscard]] deserialize_result<T> deserialize(const View& v) const {
+            deserialize_result<T> ret{};
+            ret.errc = deserialize_to(ret.value, v);
+            return ret;
+        }
+
+        template <typename Byte, typename = std::enable_if_t<detail::dm_pack_byte_v<Byte>>>
+        [[nodiscard]] deserialize_result<T> deserialize(const Byte* data, std::size_t size) const {
+            deserialize_result<T> ret{};
+            ret.errc = deserialize_to(ret.value, data, size);
+            return ret;
+        }
+
+    private:
+        std::errc build(const std::vector<int>& field_map) {
+            using types = decltype(detail::get_types(std::declval<T>()));
+            std::vector<detail::schema_node> nodes;
+            std::errc code = detail::schema_parser(literal_).parse_all(nodes);
+            if (code != std::errc{}) { return code; }
+            if constexpr (std::tuple_size_v<types> == 1 && dm_is_same_v<dm_remove_cvref_t<std::tuple_element_t<0, types>>, T>) {
+                // 单个非聚合类型，描述串就是它自身
+                if (nodes.size() != 1 || !field_map.empty()) { return std::errc::invalid_argument; }
+                root_ = std::move(nodes[0]);
+                return detail::bind_schema<T>(root_, literal_, false);
+            }
+            else {
+                // 去除了填充的顶层结构体，描述串是它自身的节点 (见 top_level_types_t)；
+                // 仅有一个去除了填充的成员时两种写法相同，按当前类型区分
+                constexpr bool single_packed_member = std::tuple_size_v<types> == 1 &&
+                    detail::get_type_id<std::tuple_element_t<0, types>>() == detail::type_id::packed_class_t;
+                if (nodes.size() == 1 && nodes[0].id == detail::type_id::packed_class_t &&
+                    (detail::pack_strips_padding<T>() || !single_packed_member)) {
+                    root_ = std::move(nodes[0]);
+                }
+                else {
+                    // 顶层结构体的描述串只有成员部分，补上外层节点后按结构体处理
+                    root_.id = detail::type_id::aggregate_class_t;
+                    root_.literal_len = literal_.size();
+                    root_.children = std::move(nodes);
+                    if ((code = detail::compute_layout(root_)) != std::errc{}) { return code; }
+                }
+                if (get_type_literal<T>() == literal_) {
+                    root_.same = true;
+                    return {};
+                }
+                if (!field_map.empty()) {
+                    if (field_map.size() != std::tuple_size_v<types>) { return std::errc::invalid_argument; }
+                    code = detail::invert_field_map(field_map, root_.children.size(), root_.field_map);
+                    if (code != std::errc{}) { return code; }
+                }
+                return detail::bind_structure<T>(root_, literal_, false);
+            }
+        }
+
+        std::string literal_;
+        uint32_t types_code_;
+        detail::schema_node root_;
+        std::errc error_{};
+    };
+
+} // namespace dm::pack
+
+#endif // __DMTYPETRAITS_PACK_MIGRATE_H_INCLUDE__
@@ -0,0 +1,151 @@
+#ifndef __DMTYPETRAITS_PACK_SNAPSHOT_H_INCLUDE__
+#define __DMTYPETRAITS_PACK_SNAPSHOT_H_INCLUDE__
+
+#include "dmtypetraits_pack_cursor.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cerrno>
+#include <memory>
+#include <fcntl.h>
+#include <string>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace dm::pack {
+
+    /**
+     * @brief 基于 fork 的后台快照: 子进程获得内存的写时复制视图，把对象流式序列化到文件。
+     *
+     * 父进程只承担 fork 本身的延迟，随后可以继续修改对象，快照内容仍是 fork 那一刻的状态。
+     * 子进程先写入 path + ".tmp"，fsync 后改名为 path，结果 (std::errc) 经管道报告给父进程。
+     * fork 出的子进程只有调用线程，父进程中其它线程持有的锁在子进程里不会被释放，
+     * 序列化的对象不能依赖这类锁。仅在 POSIX 系统上提供。
+     */
+    class snapshot {
+    public:
+        snapshot() = default;
+        snapshot(const snapshot&) = delete;
+        snapshot& operator=(const snapshot&) = delete;
+
+        ~snapshot() {
+            if (running()) { wait(); }
+        }
+
+        /**
+         * @brief 开始一次快照；已有快照在进行时返回 std::errc::device_or_resource_busy。
+         */
+        template <typename... Args>
+        std::errc start(const std::string& path, const Args&... args) {
+            static_assert(sizeof...(args) > 0);
+            if (running()) { return std::errc::device_or_resource_busy; }
+            int fds[2];
+            if (::pipe(fds) != 0) { return static_cast<std::errc>(errno); }
+            pid_t pid = ::fork();
+            if (pid < 0) {
+                int err = errno;
+                ::close(fds[0]);
+                ::close(fds[1]);
+                return static_cast<std::errc>(err);
+            }
+            if (pid == 0) {
+                ::close(fds[0]);
+                // 异常不能越过 fork 边界: 否则子进程会沿着父进程的调用栈继续执行
+                int result;
+                try {
+                    result = static_cast<int>(write_file(path, args...));
+                }
+                catch (...) {
+                    result = static_cast<int>(std::errc::io_error);
+                }
+                ssize_t n;
+                do { n = ::write(fds[1], &result, sizeof(result)); } while (n < 0 && errno == EINTR);
+                ::_exit(result == 0 ? 0 : 1);
+            }
+            ::close(fds[1]);
+            pid_ = pid;
+            fd_ = fds[0];
+            return {};
+        }
+
+        bool running() const { return pid_ > 0; }
+
+        /**
+         * @brief 不阻塞地查询结果: 仍在进行时返回 std::errc::resource_unavailable_try_again。
+         */
+        std::errc poll() { return reap(WNOHANG); }
+
+        /**
+         * @brief 等待快照结束并返回结果；没有进行中的快照时返回上一次的结果。
+         */
+        std::errc wait() { return reap(0); }
+
+    private:
+        static constexpr std::size_t chunk_size = 64 * 1024;
+
+        template <typename... Args>
+        static std::errc write_file(const std::string& path, const Args&... args) {
+            std::string tmp = path + ".tmp";
+            int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0) { return static_cast<std::errc>(errno); }
+            std::errc code{};
+            try {
+                pack_cursor cursor(args...);
+                std::unique_ptr<char[]> buffer(new char[chunk_size]);
+                while (code == std::errc{} && !cursor.done()) {
+                    code = write_all(fd, buffer.get(), cursor.step(buffer.get(), chunk_size));
+                }
+            }
+            catch (...) {
+                // 分配失败时照常关闭并删除临时文件
+                code = std::errc::io_error;
+            }
+            if (code == std::errc{} && ::fsync(fd) != 0) { code = static_cast<std::errc>(errno); }
+            if (::close(fd) != 0 && code == std::errc{}) { code = static_cast<std::errc>(errno); }
+            if (code == std::errc{} && ::rename(tmp.c_str(), path.c_str()) != 0) { code = static_cast<std::errc>(errno); }
+            if (code != std::errc{}) { ::unlink(tmp.c_str()); }
+            return code;
+        }
+
+        static std::errc write_all(int fd, const char* data, std::size_t size) {
+            while (size > 0) {
+                ssize_t n = ::write(fd, data, size);
+                if (n < 0) {
+                    if (errno == EINTR) { continue; }
+                    return static_cast<std::errc>(errno);
+                }
+                data += n;
+                size -= static_cast<std::size_t>(n);
+            }
+            return {};
+        }
+
+        std::errc reap(int options) {
+            if (!running()) { return result_; }
+            int status = 0;
+            pid_t r;
+            do { r = ::waitpid(pid_, &status, options); } while (r < 0 && errno == EINTR);
+            if (r == 0) { return std::errc::resource_unavailable_try_again; }
+            int result = static_cast<int>(std::errc::io_error);
+            // 子进程异常退出 (如被信号杀死) 时管道里没有结果
+            if (r == pid_ && ::read(fd_, &result, sizeof(result)) != static_cast<ssize_t>(sizeof(result))) {
+                result = static_cast<int>(std::errc::io_error);
+            }
+            ::close(fd_);
+            pid_ = -1;
+            fd_ = -1;
+            result_ = static_cast<std::errc>(result);
+            return result_;
+        }
+
+        pid_t pid_ = -1;
+        int fd_ = -1;
+        std::errc result_{};
+    };
+
+} // namespace dm::pack
+
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#endif // __DMTYPETRAITS_PACK_SNAPSHOT_H_INCLUDE__
@@ -10,14 +10,24 @@
 #include <string>
 #endif
 
+// 成员名提取依赖 C++20 允许以子对象地址作为非类型模板实参
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#define DMPACK_HAS_MEMBER_NAMES 1
+#else
+#define DMPACK_HAS_MEMBER_NAMES 0
+#endif
+
 #if defined __clang__
 #define DMPACK_INLINE __attribute__((always_inline)) inline
+#define DMPACK_NOINLINE __attribute__((noinline)) inline
 #define DMPACK_CONSTEXPR_INLINE_LAMBDA __attribute__((always_inline)) constexpr
 #elif defined _MSC_VER
 #define DMPACK_INLINE __forceinline
+#define DMPACK_NOINLINE __declspec(noinline) inline
 #define DMPACK_CONSTEXPR_INLINE_LAMBDA constexpr
 #else
 #define DMPACK_INLINE __attribute__((always_inline)) inline
+#define DMPACK_NOINLINE __attribute__((noinline)) inline
 #define DMPACK_CONSTEXPR_INLINE_LAMBDA constexpr __attribute__((always_inline))
 #endif
 
@@ -31,6 +41,8 @@ namespace dm::pack {
             template<typename T> struct has_data<T, std::void_t<decltype(std::declval<T>().data())>> : std::true_type {};
             template<typename T, typename = void> struct has_resize : std::false_type {};
             template<typename T> struct has_resize<T, std::void_t<decltype(std::declval<T>().resize(0))>> : std::true_type {};
+            template<typename T, typename = void> struct has_reserve : std::false_type {};
+            template<typename T> struct has_reserve<T, std::void_t<decltype(std::declval<T>().reserve(0))>> : std::true_type {};
             template <typename T> struct is_std_vector : std::false_type {};
             template <typename... args> struct is_std_vector<std::vector<args...>> : std::true_type {};
             template <typename T> struct is_std_basic_string : std::false_type {};
@@ -50,6 +62,7 @@ namespace dm::pack {
         template<typename T> inline constexpr bool dm_pack_has_length_v = dm_detail::has_length<T>::value;
         template<typename T> inline constexpr bool dm_pack_has_data_v = dm_detail::has_data<T>::value;
         template<typename T> inline constexpr bool dm_pack_has_resize_v = dm_detail::has_resize<T>::value;
+        template<typename T> inline constexpr bool dm_pack_has_reserve_v = dm_detail::has_reserve<T>::value;
         template<typename T> inline constexpr bool dm_pack_is_std_vector_v = dm_detail::is_std_vector<dm_remove_cvref_t<T>>::value;
         template<typename T> inline constexpr bool dm_pack_is_std_basic_string_v = dm_detail::is_std_basic_string<dm_remove_cvref_t<T>>::value;
 
@@ -90,28 +103,675 @@ namespace dm::pack {
         inline constexpr bool dm_pack_has_members_count_v = dm_pack_has_members_count_trait<Type>::value;
 
 
+        // 不转换为 nullptr_t: 否则 std::shared_ptr/std::unique_ptr 成员可经由其 nullptr_t 构造函数初始化，产生歧义
         struct UniversalType {
-            template <typename T>
+            template <typename T, typename = std::enable_if_t<!std::is_same_v<T, std::nullptr_t>>>
             operator T();
         };
 
-        template <typename T, typename... Args>
+        // 只能转换为整数类型，用于 std::bitset 这类从 UniversalType 构造有歧义的成员
+        struct UniversalIntegralType {
+            template <typename T, typename = std::enable_if_t<dm_is_integral_v<T>>>
+            operator T();
+        };
+
+        template <std::size_t>
+        using universal_at_t = UniversalType;
+
+        // T 能否由 Prefix 中的各类型再加 N 个 UniversalType 聚合初始化
+        template <typename T, typename Prefix, typename Seq>
+        struct brace_constructible_with;
+
+        template <typename T, typename... Prefix, std::size_t... I>
+        struct brace_constructible_with<T, std::tuple<Prefix...>, std::index_sequence<I...>>
+            : std::bool_constant<is_brace_constructible_v<T, Prefix..., universal_at_t<I>...>> {};
+
+        template <typename T, typename Prefix, std::size_t N>
+        inline constexpr bool brace_constructible_with_v = brace_constructible_with<T, Prefix, std::make_index_sequence<N>>::value;
+
+        // 在 [Lo, Hi] 中二分查找能追加的 UniversalType 的最大个数 (已知 Lo 个可行)，模板深度为 O(log n)
+        template <typename T, typename Prefix, std::size_t Lo, std::size_t Hi>
+        constexpr std::size_t max_universal_count() {
+            if constexpr (Lo == Hi) { return Lo; }
+            else {
+                constexpr std::size_t Mid = Lo + (Hi - Lo + 1) / 2;
+                if constexpr (brace_constructible_with_v<T, Prefix, Mid>) { return max_universal_count<T, Prefix, Mid, Hi>(); }
+                else { return max_universal_count<T, Prefix, Lo, Mid - 1>(); }
+            }
+        }
+
+        template <typename Prefix, typename Seq, typename Tail>
+        struct extend_prefix;
+
+        template <typename... Prefix, std::size_t... I, typename Tail>
+        struct extend_prefix<std::tuple<Prefix...>, std::index_sequence<I...>, Tail> {
+            using type = std::tuple<Prefix..., universal_at_t<I>..., Tail>;
+        };
+
+        constexpr static auto MaxVisitMembers = 256;
+
+        // 前缀之后先二分出连续可由 UniversalType 初始化的成员数，
+        // 遇到 std::bitset 这类有歧义的成员时以 UniversalIntegralType 占位，再从它之后继续查找
+        template <typename T, typename Prefix>
+        constexpr std::size_t member_count_after() {
+            constexpr std::size_t prefix = std::tuple_size_v<Prefix>;
+            // 每个成员至少占一个字节，多查一个以便超出上限时能被 visit_members 的断言发现
+            constexpr std::size_t limit = (std::min)(sizeof(T), static_cast<std::size_t>(MaxVisitMembers) + 1);
+            constexpr std::size_t hi = limit > prefix ? limit - prefix : 0;
+            constexpr std::size_t n = max_universal_count<T, Prefix, 0, hi>();
+            using next = typename extend_prefix<Prefix, std::make_index_sequence<n>, UniversalIntegralType>::type;
+            if constexpr (prefix + n < limit && brace_constructible_with_v<T, next, 0>) {
+                return member_count_after<T, next>();
+            }
+            else { return prefix + n; }
+        }
+
+        template <typename T>
         constexpr auto member_count() {
             if constexpr (dm_pack_has_members_count_v<T>) {
                 return T::members_count_t::value;
             }
             else {
-                if constexpr (!is_brace_constructible_v<T, Args..., UniversalType>) {
-                    return sizeof...(Args);
-                }
-                else {
-                    return member_count<T, Args..., UniversalType>();
-                }
+                return member_count_after<T, std::tuple<>>();
             }
         }
 
+        template <std::size_t Count>
+        struct members_visitor;
+
+        template <>
+        struct members_visitor<0> {
+            template <typename T, typename Visitor>
+            static constexpr decltype(auto) DMPACK_INLINE visit(T&, Visitor& visitor) { return visitor(); }
+        };
 
-        constexpr static auto MaxVisitMembers = 64;
+        // 结构化绑定的名字表由预处理器按 16 个一组拼出，每个成员个数对应一个特化
+#define DMPACK_MEMBERS_BLOCK_0 a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16
+#define DMPACK_MEMBERS_BLOCK_1 a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32
+#define DMPACK_MEMBERS_BLOCK_2 a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48
+#define DMPACK_MEMBERS_BLOCK_3 a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62, a63, a64
+#define DMPACK_MEMBERS_BLOCK_4 a65, a66, a67, a68, a69, a70, a71, a72, a73, a74, a75, a76, a77, a78, a79, a80
+#define DMPACK_MEMBERS_BLOCK_5 a81, a82, a83, a84, a85, a86, a87, a88, a89, a90, a91, a92, a93, a94, a95, a96
+#define DMPACK_MEMBERS_BLOCK_6 a97, a98, a99, a100, a101, a102, a103, a104, a105, a106, a107, a108, a109, a110, a111, a112
+#define DMPACK_MEMBERS_BLOCK_7 a113, a114, a115, a116, a117, a118, a119, a120, a121, a122, a123, a124, a125, a126, a127, a128
+#define DMPACK_MEMBERS_BLOCK_8 a129, a130, a131, a132, a133, a134, a135, a136, a137, a138, a139, a140, a141, a142, a143, a144
+#define DMPACK_MEMBERS_BLOCK_9 a145, a146, a147, a148, a149, a150, a151, a152, a153, a154, a155, a156, a157, a158, a159, a160
+#define DMPACK_MEMBERS_BLOCK_10 a161, a162, a163, a164, a165, a166, a167, a168, a169, a170, a171, a172, a173, a174, a175, a176
+#define DMPACK_MEMBERS_BLOCK_11 a177, a178, a179, a180, a181, a182, a183, a184, a185, a186, a187, a188, a189, a190, a191, a192
+#define DMPACK_MEMBERS_BLOCK_12 a193, a194, a195, a196, a197, a198, a199, a200, a201, a202, a203, a204, a205, a206, a207, a208
+#define DMPACK_MEMBERS_BLOCK_13 a209, a210, a211, a212, a213, a214, a215, a216, a217, a218, a219, a220, a221, a222, a223, a224
+#define DMPACK_MEMBERS_BLOCK_14 a225, a226, a227, a228, a229, a230, a231, a232, a233, a234, a235, a236, a237, a238, a239, a240
+#define DMPACK_MEMBERS_BLOCK_15 a241, a242, a243, a244, a245, a246, a247, a248, a249, a250, a251, a252, a253, a254, a255, a256
+#define DMPACK_MEMBERS_1 a1
+#define DMPACK_MEMBERS_2 a1, a2
+#define DMPACK_MEMBERS_3 a1, a2, a3
+#define DMPACK_MEMBERS_4 a1, a2, a3, a4
+#define DMPACK_MEMBERS_5 a1, a2, a3, a4, a5
+#define DMPACK_MEMBERS_6 a1, a2, a3, a4, a5, a6
+#define DMPACK_MEMBERS_7 a1, a2, a3, a4, a5, a6, a7
+#define DMPACK_MEMBERS_8 a1, a2, a3, a4, a5, a6, a7, a8
+#define DMPACK_MEMBERS_9 a1, a2, a3, a4, a5, a6, a7, a8, a9
+#define DMPACK_MEMBERS_10 a1, a2, a3, a4, a5, a6, a7, a8, a9, a10
+#define DMPACK_MEMBERS_11 a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11
+#define DMPACK_MEMBERS_12 a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12
+#define DMPACK_MEMBERS_13 a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13
+#define DMPACK_MEMBERS_14 a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14
+#define DMPACK_MEMBERS_15 a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15
+#define DMPACK_MEMBERS_16 DMPACK_MEMBERS_BLOCK_0
+#define DMPACK_MEMBERS_17 DMPACK_MEMBERS_BLOCK_0, a17
+#define DMPACK_MEMBERS_18 DMPACK_MEMBERS_BLOCK_0, a17, a18
+#define DMPACK_MEMBERS_19 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19
+#define DMPACK_MEMBERS_20 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20
+#define DMPACK_MEMBERS_21 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21
+#define DMPACK_MEMBERS_22 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22
+#define DMPACK_MEMBERS_23 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23
+#define DMPACK_MEMBERS_24 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23, a24
+#define DMPACK_MEMBERS_25 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23, a24, a25
+#define DMPACK_MEMBERS_26 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26
+#define DMPACK_MEMBERS_27 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27
+#define DMPACK_MEMBERS_28 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28
+#define DMPACK_MEMBERS_29 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29
+#define DMPACK_MEMBERS_30 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30
+#define DMPACK_MEMBERS_31 DMPACK_MEMBERS_BLOCK_0, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31
+#define DMPACK_MEMBERS_32 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1
+#define DMPACK_MEMBERS_33 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33
+#define DMPACK_MEMBERS_34 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34
+#define DMPACK_MEMBERS_35 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35
+#define DMPACK_MEMBERS_36 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36
+#define DMPACK_MEMBERS_37 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37
+#define DMPACK_MEMBERS_38 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38
+#define DMPACK_MEMBERS_39 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39
+#define DMPACK_MEMBERS_40 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39, a40
+#define DMPACK_MEMBERS_41 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39, a40, a41
+#define DMPACK_MEMBERS_42 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42
+#define DMPACK_MEMBERS_43 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43
+#define DMPACK_MEMBERS_44 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44
+#define DMPACK_MEMBERS_45 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45
+#define DMPACK_MEMBERS_46 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46
+#define DMPACK_MEMBERS_47 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47
+#define DMPACK_MEMBERS_48 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2
+#define DMPACK_MEMBERS_49 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49
+#define DMPACK_MEMBERS_50 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50
+#define DMPACK_MEMBERS_51 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51
+#define DMPACK_MEMBERS_52 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52
+#define DMPACK_MEMBERS_53 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53
+#define DMPACK_MEMBERS_54 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54
+#define DMPACK_MEMBERS_55 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55
+#define DMPACK_MEMBERS_56 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55, a56
+#define DMPACK_MEMBERS_57 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55, a56, a57
+#define DMPACK_MEMBERS_58 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58
+#define DMPACK_MEMBERS_59 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59
+#define DMPACK_MEMBERS_60 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60
+#define DMPACK_MEMBERS_61 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61
+#define DMPACK_MEMBERS_62 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62
+#define DMPACK_MEMBERS_63 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, a49, a50, a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62, a63
+#define DMPACK_MEMBERS_64 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3
+#define DMPACK_MEMBERS_65 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65
+#define DMPACK_MEMBERS_66 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66
+#define DMPACK_MEMBERS_67 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67
+#define DMPACK_MEMBERS_68 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68
+#define DMPACK_MEMBERS_69 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69
+#define DMPACK_MEMBERS_70 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70
+#define DMPACK_MEMBERS_71 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71
+#define DMPACK_MEMBERS_72 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71, a72
+#define DMPACK_MEMBERS_73 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71, a72, a73
+#define DMPACK_MEMBERS_74 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71, a72, a73, a74
+#define DMPACK_MEMBERS_75 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71, a72, a73, a74, a75
+#define DMPACK_MEMBERS_76 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71, a72, a73, a74, a75, a76
+#define DMPACK_MEMBERS_77 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71, a72, a73, a74, a75, a76, a77
+#define DMPACK_MEMBERS_78 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71, a72, a73, a74, a75, a76, a77, a78
+#define DMPACK_MEMBERS_79 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, a65, a66, a67, a68, a69, a70, a71, a72, a73, a74, a75, a76, a77, a78, a79
+#define DMPACK_MEMBERS_80 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4
+#define DMPACK_MEMBERS_81 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81
+#define DMPACK_MEMBERS_82 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82
+#define DMPACK_MEMBERS_83 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83
+#define DMPACK_MEMBERS_84 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84
+#define DMPACK_MEMBERS_85 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85
+#define DMPACK_MEMBERS_86 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86
+#define DMPACK_MEMBERS_87 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87
+#define DMPACK_MEMBERS_88 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87, a88
+#define DMPACK_MEMBERS_89 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87, a88, a89
+#define DMPACK_MEMBERS_90 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87, a88, a89, a90
+#define DMPACK_MEMBERS_91 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87, a88, a89, a90, a91
+#define DMPACK_MEMBERS_92 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87, a88, a89, a90, a91, a92
+#define DMPACK_MEMBERS_93 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87, a88, a89, a90, a91, a92, a93
+#define DMPACK_MEMBERS_94 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87, a88, a89, a90, a91, a92, a93, a94
+#define DMPACK_MEMBERS_95 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, a81, a82, a83, a84, a85, a86, a87, a88, a89, a90, a91, a92, a93, a94, a95
+#define DMPACK_MEMBERS_96 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5
+#define DMPACK_MEMBERS_97 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97
+#define DMPACK_MEMBERS_98 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98
+#define DMPACK_MEMBERS_99 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99
+#define DMPACK_MEMBERS_100 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100
+#define DMPACK_MEMBERS_101 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101
+#define DMPACK_MEMBERS_102 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102
+#define DMPACK_MEMBERS_103 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103
+#define DMPACK_MEMBERS_104 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103, a104
+#define DMPACK_MEMBERS_105 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103, a104, a105
+#define DMPACK_MEMBERS_106 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103, a104, a105, a106
+#define DMPACK_MEMBERS_107 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103, a104, a105, a106, a107
+#define DMPACK_MEMBERS_108 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103, a104, a105, a106, a107, a108
+#define DMPACK_MEMBERS_109 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103, a104, a105, a106, a107, a108, a109
+#define DMPACK_MEMBERS_110 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103, a104, a105, a106, a107, a108, a109, a110
+#define DMPACK_MEMBERS_111 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, a97, a98, a99, a100, a101, a102, a103, a104, a105, a106, a107, a108, a109, a110, a111
+#define DMPACK_MEMBERS_112 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6
+#define DMPACK_MEMBERS_113 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113
+#define DMPACK_MEMBERS_114 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114
+#define DMPACK_MEMBERS_115 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115
+#define DMPACK_MEMBERS_116 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116
+#define DMPACK_MEMBERS_117 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117
+#define DMPACK_MEMBERS_118 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118
+#define DMPACK_MEMBERS_119 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119
+#define DMPACK_MEMBERS_120 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119, a120
+#define DMPACK_MEMBERS_121 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119, a120, a121
+#define DMPACK_MEMBERS_122 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119, a120, a121, a122
+#define DMPACK_MEMBERS_123 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119, a120, a121, a122, a123
+#define DMPACK_MEMBERS_124 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119, a120, a121, a122, a123, a124
+#define DMPACK_MEMBERS_125 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119, a120, a121, a122, a123, a124, a125
+#define DMPACK_MEMBERS_126 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119, a120, a121, a122, a123, a124, a125, a126
+#define DMPACK_MEMBERS_127 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, a113, a114, a115, a116, a117, a118, a119, a120, a121, a122, a123, a124, a125, a126, a127
+#define DMPACK_MEMBERS_128 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7
+#define DMPACK_MEMBERS_129 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129
+#define DMPACK_MEMBERS_130 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130
+#define DMPACK_MEMBERS_131 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131
+#define DMPACK_MEMBERS_132 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132
+#define DMPACK_MEMBERS_133 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133
+#define DMPACK_MEMBERS_134 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134
+#define DMPACK_MEMBERS_135 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135
+#define DMPACK_MEMBERS_136 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135, a136
+#define DMPACK_MEMBERS_137 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135, a136, a137
+#define DMPACK_MEMBERS_138 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135, a136, a137, a138
+#define DMPACK_MEMBERS_139 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135, a136, a137, a138, a139
+#define DMPACK_MEMBERS_140 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135, a136, a137, a138, a139, a140
+#define DMPACK_MEMBERS_141 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135, a136, a137, a138, a139, a140, a141
+#define DMPACK_MEMBERS_142 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135, a136, a137, a138, a139, a140, a141, a142
+#define DMPACK_MEMBERS_143 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, a129, a130, a131, a132, a133, a134, a135, a136, a137, a138, a139, a140, a141, a142, a143
+#define DMPACK_MEMBERS_144 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8
+#define DMPACK_MEMBERS_145 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145
+#define DMPACK_MEMBERS_146 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146
+#define DMPACK_MEMBERS_147 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147
+#define DMPACK_MEMBERS_148 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148
+#define DMPACK_MEMBERS_149 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149
+#define DMPACK_MEMBERS_150 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150
+#define DMPACK_MEMBERS_151 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151
+#define DMPACK_MEMBERS_152 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151, a152
+#define DMPACK_MEMBERS_153 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151, a152, a153
+#define DMPACK_MEMBERS_154 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151, a152, a153, a154
+#define DMPACK_MEMBERS_155 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151, a152, a153, a154, a155
+#define DMPACK_MEMBERS_156 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151, a152, a153, a154, a155, a156
+#define DMPACK_MEMBERS_157 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151, a152, a153, a154, a155, a156, a157
+#define DMPACK_MEMBERS_158 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151, a152, a153, a154, a155, a156, a157, a158
+#define DMPACK_MEMBERS_159 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, a145, a146, a147, a148, a149, a150, a151, a152, a153, a154, a155, a156, a157, a158, a159
+#define DMPACK_MEMBERS_160 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9
+#define DMPACK_MEMBERS_161 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161
+#define DMPACK_MEMBERS_162 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162
+#define DMPACK_MEMBERS_163 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163
+#define DMPACK_MEMBERS_164 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164
+#define DMPACK_MEMBERS_165 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165
+#define DMPACK_MEMBERS_166 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166
+#define DMPACK_MEMBERS_167 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167
+#define DMPACK_MEMBERS_168 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167, a168
+#define DMPACK_MEMBERS_169 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167, a168, a169
+#define DMPACK_MEMBERS_170 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167, a168, a169, a170
+#define DMPACK_MEMBERS_171 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167, a168, a169, a170, a171
+#define DMPACK_MEMBERS_172 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167, a168, a169, a170, a171, a172
+#define DMPACK_MEMBERS_173 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167, a168, a169, a170, a171, a172, a173
+#define DMPACK_MEMBERS_174 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167, a168, a169, a170, a171, a172, a173, a174
+#define DMPACK_MEMBERS_175 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, a161, a162, a163, a164, a165, a166, a167, a168, a169, a170, a171, a172, a173, a174, a175
+#define DMPACK_MEMBERS_176 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10
+#define DMPACK_MEMBERS_177 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177
+#define DMPACK_MEMBERS_178 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178
+#define DMPACK_MEMBERS_179 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179
+#define DMPACK_MEMBERS_180 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180
+#define DMPACK_MEMBERS_181 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181
+#define DMPACK_MEMBERS_182 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182
+#define DMPACK_MEMBERS_183 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183
+#define DMPACK_MEMBERS_184 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183, a184
+#define DMPACK_MEMBERS_185 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183, a184, a185
+#define DMPACK_MEMBERS_186 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183, a184, a185, a186
+#define DMPACK_MEMBERS_187 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183, a184, a185, a186, a187
+#define DMPACK_MEMBERS_188 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183, a184, a185, a186, a187, a188
+#define DMPACK_MEMBERS_189 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183, a184, a185, a186, a187, a188, a189
+#define DMPACK_MEMBERS_190 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183, a184, a185, a186, a187, a188, a189, a190
+#define DMPACK_MEMBERS_191 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, a177, a178, a179, a180, a181, a182, a183, a184, a185, a186, a187, a188, a189, a190, a191
+#define DMPACK_MEMBERS_192 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11
+#define DMPACK_MEMBERS_193 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193
+#define DMPACK_MEMBERS_194 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194
+#define DMPACK_MEMBERS_195 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195
+#define DMPACK_MEMBERS_196 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196
+#define DMPACK_MEMBERS_197 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197
+#define DMPACK_MEMBERS_198 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198
+#define DMPACK_MEMBERS_199 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199
+#define DMPACK_MEMBERS_200 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199, a200
+#define DMPACK_MEMBERS_201 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199, a200, a201
+#define DMPACK_MEMBERS_202 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199, a200, a201, a202
+#define DMPACK_MEMBERS_203 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199, a200, a201, a202, a203
+#define DMPACK_MEMBERS_204 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199, a200, a201, a202, a203, a204
+#define DMPACK_MEMBERS_205 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199, a200, a201, a202, a203, a204, a205
+#define DMPACK_MEMBERS_206 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199, a200, a201, a202, a203, a204, a205, a206
+#define DMPACK_MEMBERS_207 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, a193, a194, a195, a196, a197, a198, a199, a200, a201, a202, a203, a204, a205, a206, a207
+#define DMPACK_MEMBERS_208 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12
+#define DMPACK_MEMBERS_209 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209
+#define DMPACK_MEMBERS_210 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210
+#define DMPACK_MEMBERS_211 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211
+#define DMPACK_MEMBERS_212 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212
+#define DMPACK_MEMBERS_213 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213
+#define DMPACK_MEMBERS_214 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214
+#define DMPACK_MEMBERS_215 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215
+#define DMPACK_MEMBERS_216 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215, a216
+#define DMPACK_MEMBERS_217 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215, a216, a217
+#define DMPACK_MEMBERS_218 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215, a216, a217, a218
+#define DMPACK_MEMBERS_219 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215, a216, a217, a218, a219
+#define DMPACK_MEMBERS_220 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215, a216, a217, a218, a219, a220
+#define DMPACK_MEMBERS_221 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215, a216, a217, a218, a219, a220, a221
+#define DMPACK_MEMBERS_222 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215, a216, a217, a218, a219, a220, a221, a222
+#define DMPACK_MEMBERS_223 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, a209, a210, a211, a212, a213, a214, a215, a216, a217, a218, a219, a220, a221, a222, a223
+#define DMPACK_MEMBERS_224 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13
+#define DMPACK_MEMBERS_225 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225
+#define DMPACK_MEMBERS_226 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226
+#define DMPACK_MEMBERS_227 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227
+#define DMPACK_MEMBERS_228 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228
+#define DMPACK_MEMBERS_229 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229
+#define DMPACK_MEMBERS_230 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230
+#define DMPACK_MEMBERS_231 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231
+#define DMPACK_MEMBERS_232 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231, a232
+#define DMPACK_MEMBERS_233 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231, a232, a233
+#define DMPACK_MEMBERS_234 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231, a232, a233, a234
+#define DMPACK_MEMBERS_235 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231, a232, a233, a234, a235
+#define DMPACK_MEMBERS_236 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231, a232, a233, a234, a235, a236
+#define DMPACK_MEMBERS_237 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231, a232, a233, a234, a235, a236, a237
+#define DMPACK_MEMBERS_238 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231, a232, a233, a234, a235, a236, a237, a238
+#define DMPACK_MEMBERS_239 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, a225, a226, a227, a228, a229, a230, a231, a232, a233, a234, a235, a236, a237, a238, a239
+#define DMPACK_MEMBERS_240 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14
+#define DMPACK_MEMBERS_241 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241
+#define DMPACK_MEMBERS_242 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242
+#define DMPACK_MEMBERS_243 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243
+#define DMPACK_MEMBERS_244 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244
+#define DMPACK_MEMBERS_245 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245
+#define DMPACK_MEMBERS_246 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246
+#define DMPACK_MEMBERS_247 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247
+#define DMPACK_MEMBERS_248 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247, a248
+#define DMPACK_MEMBERS_249 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247, a248, a249
+#define DMPACK_MEMBERS_250 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247, a248, a249, a250
+#define DMPACK_MEMBERS_251 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247, a248, a249, a250, a251
+#define DMPACK_MEMBERS_252 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247, a248, a249, a250, a251, a252
+#define DMPACK_MEMBERS_253 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247, a248, a249, a250, a251, a252, a253
+#define DMPACK_MEMBERS_254 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247, a248, a249, a250, a251, a252, a253, a254
+#define DMPACK_MEMBERS_255 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, a241, a242, a243, a244, a245, a246, a247, a248, a249, a250, a251, a252, a253, a254, a255
+#define DMPACK_MEMBERS_256 DMPACK_MEMBERS_BLOCK_0, DMPACK_MEMBERS_BLOCK_1, DMPACK_MEMBERS_BLOCK_2, DMPACK_MEMBERS_BLOCK_3, DMPACK_MEMBERS_BLOCK_4, DMPACK_MEMBERS_BLOCK_5, DMPACK_MEMBERS_BLOCK_6, DMPACK_MEMBERS_BLOCK_7, DMPACK_MEMBERS_BLOCK_8, DMPACK_MEMBERS_BLOCK_9, DMPACK_MEMBERS_BLOCK_10, DMPACK_MEMBERS_BLOCK_11, DMPACK_MEMBERS_BLOCK_12, DMPACK_MEMBERS_BLOCK_13, DMPACK_MEMBERS_BLOCK_14, DMPACK_MEMBERS_BLOCK_15
+#define DMPACK_MEMBERS_VISITOR(N)                                                          \
+        template <>                                                                            \
+        struct members_visitor<N> {                                                            \
+            template <typename T, typename Visitor>                                            \
+            static constexpr decltype(auto) DMPACK_INLINE visit(T& object, Visitor& visitor) { \
+                auto&& [DMPACK_MEMBERS_##N] = object;                                          \
+                return visitor(DMPACK_MEMBERS_##N);                                            \
+            }                                                                                  \
+        };
+        DMPACK_MEMBERS_VISITOR(1) DMPACK_MEMBERS_VISITOR(2) DMPACK_MEMBERS_VISITOR(3) DMPACK_MEMBERS_VISITOR(4) DMPACK_MEMBERS_VISITOR(5) DMPACK_MEMBERS_VISITOR(6) DMPACK_MEMBERS_VISITOR(7) DMPACK_MEMBERS_VISITOR(8)
+        DMPACK_MEMBERS_VISITOR(9) DMPACK_MEMBERS_VISITOR(10) DMPACK_MEMBERS_VISITOR(11) DMPACK_MEMBERS_VISITOR(12) DMPACK_MEMBERS_VISITOR(13) DMPACK_MEMBERS_VISITOR(14) DMPACK_MEMBERS_VISITOR(15) DMPACK_MEMBERS_VISITOR(16)
+        DMPACK_MEMBERS_VISITOR(17) DMPACK_MEMBERS_VISITOR(18) DMPACK_MEMBERS_VISITOR(19) DMPACK_MEMBERS_VISITOR(20) DMPACK_MEMBERS_VISITOR(21) DMPACK_MEMBERS_VISITOR(22) DMPACK_MEMBERS_VISITOR(23) DMPACK_MEMBERS_VISITOR(24)
+        DMPACK_MEMBERS_VISITOR(25) DMPACK_MEMBERS_VISITOR(26) DMPACK_MEMBERS_VISITOR(27) DMPACK_MEMBERS_VISITOR(28) DMPACK_MEMBERS_VISITOR(29) DMPACK_MEMBERS_VISITOR(30) DMPACK_MEMBERS_VISITOR(31) DMPACK_MEMBERS_VISITOR(32)
+        DMPACK_MEMBERS_VISITOR(33) DMPACK_MEMBERS_VISITOR(34) DMPACK_MEMBERS_VISITOR(35) DMPACK_MEMBERS_VISITOR(36) DMPACK_MEMBERS_VISITOR(37) DMPACK_MEMBERS_VISITOR(38) DMPACK_MEMBERS_VISITOR(39) DMPACK_MEMBERS_VISITOR(40)
+        DMPACK_MEMBERS_VISITOR(41) DMPACK_MEMBERS_VISITOR(42) DMPACK_MEMBERS_VISITOR(43) DMPACK_MEMBERS_VISITOR(44) DMPACK_MEMBERS_VISITOR(45) DMPACK_MEMBERS_VISITOR(46) DMPACK_MEMBERS_VISITOR(47) DMPACK_MEMBERS_VISITOR(48)
+        DMPACK_MEMBERS_VISITOR(49) DMPACK_MEMBERS_VISITOR(50) DMPACK_MEMBERS_VISITOR(51) DMPACK_MEMBERS_VISITOR(52) DMPACK_MEMBERS_VISITOR(53) DMPACK_MEMBERS_VISITOR(54) DMPACK_MEMBERS_VISITOR(55) DMPACK_MEMBERS_VISITOR(56)
+        DMPACK_MEMBERS_VISITOR(57) DMPACK_MEMBERS_VISITOR(58) DMPACK_MEMBERS_VISITOR(59) DMPACK_MEMBERS_VISITOR(60) DMPACK_MEMBERS_VISITOR(61) DMPACK_MEMBERS_VISITOR(62) DMPACK_MEMBERS_VISITOR(63) DMPACK_MEMBERS_VISITOR(64)
+        DMPACK_MEMBERS_VISITOR(65) DMPACK_MEMBERS_VISITOR(66) DMPACK_MEMBERS_VISITOR(67) DMPACK_MEMBERS_VISITOR(68) DMPACK_MEMBERS_VISITOR(69) DMPACK_MEMBERS_VISITOR(70) DMPACK_MEMBERS_VISITOR(71) DMPACK_MEMBERS_VISITOR(72)
+        DMPACK_MEMBERS_VISITOR(73) DMPACK_MEMBERS_VISITOR(74) DMPACK_MEMBERS_VISITOR(75) DMPACK_MEMBERS_VISITOR(76) DMPACK_MEMBERS_VISITOR(77) DMPACK_MEMBERS_VISITOR(78) DMPACK_MEMBERS_VISITOR(79) DMPACK_MEMBERS_VISITOR(80)
+        DMPACK_MEMBERS_VISITOR(81) DMPACK_MEMBERS_VISITOR(82) DMPACK_MEMBERS_VISITOR(83) DMPACK_MEMBERS_VISITOR(84) DMPACK_MEMBERS_VISITOR(85) DMPACK_MEMBERS_VISITOR(86) DMPACK_MEMBERS_VISITOR(87) DMPACK_MEMBERS_VISITOR(88)
+        DMPACK_MEMBERS_VISITOR(89) DMPACK_MEMBERS_VISITOR(90) DMPACK_MEMBERS_VISITOR(91) DMPACK_MEMBERS_VISITOR(92) DMPACK_MEMBERS_VISITOR(93) DMPACK_MEMBERS_VISITOR(94) DMPACK_MEMBERS_VISITOR(95) DMPACK_MEMBERS_VISITOR(96)
+        DMPACK_MEMBERS_VISITOR(97) DMPACK_MEMBERS_VISITOR(98) DMPACK_MEMBERS_VISITOR(99) DMPACK_MEMBERS_VISITOR(100) DMPACK_MEMBERS_VISITOR(101) DMPACK_MEMBERS_VISITOR(102) DMPACK_MEMBERS_VISITOR(103) DMPACK_MEMBERS_VISITOR(104)
+        DMPACK_MEMBERS_VISITOR(105) DMPACK_MEMBERS_VISITOR(106) DMPACK_MEMBERS_VISITOR(107) DMPACK_MEMBERS_VISITOR(108) DMPACK_MEMBERS_VISITOR(109) DMPACK_MEMBERS_VISITOR(110) DMPACK_MEMBERS_VISITOR(111) DMPACK_MEMBERS_VISITOR(112)
+        DMPACK_MEMBERS_VISITOR(113) DMPACK_MEMBERS_VISITOR(114) DMPACK_MEMBERS_VISITOR(115) DMPACK_MEMBERS_VISITOR(116) DMPACK_MEMBERS_VISITOR(117) DMPACK_MEMBERS_VISITOR(118) DMPACK_MEMBERS_VISITOR(119) DMPACK_MEMBERS_VISITOR(120)
+        DMPACK_MEMBERS_VISITOR(121) DMPACK_MEMBERS_VISITOR(122) DMPACK_MEMBERS_VISITOR(123) DMPACK_MEMBERS_VISITOR(124) DMPACK_MEMBERS_VISITOR(125) DMPACK_MEMBERS_VISITOR(126) DMPACK_MEMBERS_VISITOR(127) DMPACK_MEMBERS_VISITOR(128)
+        DMPACK_MEMBERS_VISITOR(129) DMPACK_MEMBERS_VISITOR(130) DMPACK_MEMBERS_VISITOR(131) DMPACK_MEMBERS_VISITOR(132) DMPACK_MEMBERS_VISITOR(133) DMPACK_MEMBERS_VISITOR(134) DMPACK_MEMBERS_VISITOR(135) DMPACK_MEMBERS_VISITOR(136)
+        DMPACK_MEMBERS_VISITOR(137) DMPACK_MEMBERS_VISITOR(138) DMPACK_MEMBERS_VISITOR(139) DMPACK_MEMBERS_VISITOR(140) DMPACK_MEMBERS_VISITOR(141) DMPACK_MEMBERS_VISITOR(142) DMPACK_MEMBERS_VISITOR(143) DMPACK_MEMBERS_VISITOR(144)
+        DMPACK_MEMBERS_VISITOR(145) DMPACK_MEMBERS_VISITOR(146) DMPACK_MEMBERS_VISITOR(147) DMPACK_MEMBERS_VISITOR(148) DMPACK_MEMBERS_VISITOR(149) DMPACK_MEMBERS_VISITOR(150) DMPACK_MEMBERS_VISITOR(151) DMPACK_MEMBERS_VISITOR(152)
+        DMPACK_MEMBERS_VISITOR(153) DMPACK_MEMBERS_VISITOR(154) DMPACK_MEMBERS_VISITOR(155) DMPACK_MEMBERS_VISITOR(156) DMPACK_MEMBERS_VISITOR(157) DMPACK_MEMBERS_VISITOR(158) DMPACK_MEMBERS_VISITOR(159) DMPACK_MEMBERS_VISITOR(160)
+        DMPACK_MEMBERS_VISITOR(161) DMPACK_MEMBERS_VISITOR(162) DMPACK_MEMBERS_VISITOR(163) DMPACK_MEMBERS_VISITOR(164) DMPACK_MEMBERS_VISITOR(165) DMPACK_MEMBERS_VISITOR(166) DMPACK_MEMBERS_VISITOR(167) DMPACK_MEMBERS_VISITOR(168)
+        DMPACK_MEMBERS_VISITOR(169) DMPACK_MEMBERS_VISITOR(170) DMPACK_MEMBERS_VISITOR(171) DMPACK_MEMBERS_VISITOR(172) DMPACK_MEMBERS_VISITOR(173) DMPACK_MEMBERS_VISITOR(174) DMPACK_MEMBERS_VISITOR(175) DMPACK_MEMBERS_VISITOR(176)
+        DMPACK_MEMBERS_VISITOR(177) DMPACK_MEMBERS_VISITOR(178) DMPACK_MEMBERS_VISITOR(179) DMPACK_MEMBERS_VISITOR(180) DMPACK_MEMBERS_VISITOR(181) DMPACK_MEMBERS_VISITOR(182) DMPACK_MEMBERS_VISITOR(183) DMPACK_MEMBERS_VISITOR(184)
+        DMPACK_MEMBERS_VISITOR(185) DMPACK_MEMBERS_VISITOR(186) DMPACK_MEMBERS_VISITOR(187) DMPACK_MEMBERS_VISITOR(188) DMPACK_MEMBERS_VISITOR(189) DMPACK_MEMBERS_VISITOR(190) DMPACK_MEMBERS_VISITOR(191) DMPACK_MEMBERS_VISITOR(192)
+        DMPACK_MEMBERS_VISITOR(193) DMPACK_MEMBERS_VISITOR(194) DMPACK_MEMBERS_VISITOR(195) DMPACK_MEMBERS_VISITOR(196) DMPACK_MEMBERS_VISITOR(197) DMPACK_MEMBERS_VISITOR(198) DMPACK_MEMBERS_VISITOR(199) DMPACK_MEMBERS_VISITOR(200)
+        DMPACK_MEMBERS_VISITOR(201) DMPACK_MEMBERS_VISITOR(202) DMPACK_MEMBERS_VISITOR(203) DMPACK_MEMBERS_VISITOR(204) DMPACK_MEMBERS_VISITOR(205) DMPACK_MEMBERS_VISITOR(206) DMPACK_MEMBERS_VISITOR(207) DMPACK_MEMBERS_VISITOR(208)
+        DMPACK_MEMBERS_VISITOR(209) DMPACK_MEMBERS_VISITOR(210) DMPACK_MEMBERS_VISITOR(211) DMPACK_MEMBERS_VISITOR(212) DMPACK_MEMBERS_VISITOR(213) DMPACK_MEMBERS_VISITOR(214) DMPACK_MEMBERS_VISITOR(215) DMPACK_MEMBERS_VISITOR(216)
+        DMPACK_MEMBERS_VISITOR(217) DMPACK_MEMBERS_VISITOR(218) DMPACK_MEMBERS_VISITOR(219) DMPACK_MEMBERS_VISITOR(220) DMPACK_MEMBERS_VISITOR(221) DMPACK_MEMBERS_VISITOR(222) DMPACK_MEMBERS_VISITOR(223) DMPACK_MEMBERS_VISITOR(224)
+        DMPACK_MEMBERS_VISITOR(225) DMPACK_MEMBERS_VISITOR(226) DMPACK_MEMBERS_VISITOR(227) DMPACK_MEMBERS_VISITOR(228) DMPACK_MEMBERS_VISITOR(229) DMPACK_MEMBERS_VISITOR(230) DMPACK_MEMBERS_VISITOR(231) DMPACK_MEMBERS_VISITOR(232)
+        DMPACK_MEMBERS_VISITOR(233) DMPACK_MEMBERS_VISITOR(234) DMPACK_MEMBERS_VISITOR(235) DMPACK_MEMBERS_VISITOR(236) DMPACK_MEMBERS_VISITOR(237) DMPACK_MEMBERS_VISITOR(238) DMPACK_MEMBERS_VISITOR(239) DMPACK_MEMBERS_VISITOR(240)
+        DMPACK_MEMBERS_VISITOR(241) DMPACK_MEMBERS_VISITOR(242) DMPACK_MEMBERS_VISITOR(243) DMPACK_MEMBERS_VISITOR(244) DMPACK_MEMBERS_VISITOR(245) DMPACK_MEMBERS_VISITOR(246) DMPACK_MEMBERS_VISITOR(247) DMPACK_MEMBERS_VISITOR(248)
+        DMPACK_MEMBERS_VISITOR(249) DMPACK_MEMBERS_VISITOR(250) DMPACK_MEMBERS_VISITOR(251) DMPACK_MEMBERS_VISITOR(252) DMPACK_MEMBERS_VISITOR(253) DMPACK_MEMBERS_VISITOR(254) DMPACK_MEMBERS_VISITOR(255) DMPACK_MEMBERS_VISITOR(256)
+#undef DMPACK_MEMBERS_VISITOR
+#undef DMPACK_MEMBERS_1
+#undef DMPACK_MEMBERS_2
+#undef DMPACK_MEMBERS_3
+#undef DMPACK_MEMBERS_4
+#undef DMPACK_MEMBERS_5
+#undef DMPACK_MEMBERS_6
+#undef DMPACK_MEMBERS_7
+#undef DMPACK_MEMBERS_8
+#undef DMPACK_MEMBERS_9
+#undef DMPACK_MEMBERS_10
+#undef DMPACK_MEMBERS_11
+#undef DMPACK_MEMBERS_12
+#undef DMPACK_MEMBERS_13
+#undef DMPACK_MEMBERS_14
+#undef DMPACK_MEMBERS_15
+#undef DMPACK_MEMBERS_16
+#undef DMPACK_MEMBERS_17
+#undef DMPACK_MEMBERS_18
+#undef DMPACK_MEMBERS_19
+#undef DMPACK_MEMBERS_20
+#undef DMPACK_MEMBERS_21
+#undef DMPACK_MEMBERS_22
+#undef DMPACK_MEMBERS_23
+#undef DMPACK_MEMBERS_24
+#undef DMPACK_MEMBERS_25
+#undef DMPACK_MEMBERS_26
+#undef DMPACK_MEMBERS_27
+#undef DMPACK_MEMBERS_28
+#undef DMPACK_MEMBERS_29
+#undef DMPACK_MEMBERS_30
+#undef DMPACK_MEMBERS_31
+#undef DMPACK_MEMBERS_32
+#undef DMPACK_MEMBERS_33
+#undef DMPACK_MEMBERS_34
+#undef DMPACK_MEMBERS_35
+#undef DMPACK_MEMBERS_36
+#undef DMPACK_MEMBERS_37
+#undef DMPACK_MEMBERS_38
+#undef DMPACK_MEMBERS_39
+#undef DMPACK_MEMBERS_40
+#undef DMPACK_MEMBERS_41
+#undef DMPACK_MEMBERS_42
+#undef DMPACK_MEMBERS_43
+#undef DMPACK_MEMBERS_44
+#undef DMPACK_MEMBERS_45
+#undef DMPACK_MEMBERS_46
+#undef DMPACK_MEMBERS_47
+#undef DMPACK_MEMBERS_48
+#undef DMPACK_MEMBERS_49
+#undef DMPACK_MEMBERS_50
+#undef DMPACK_MEMBERS_51
+#undef DMPACK_MEMBERS_52
+#undef DMPACK_MEMBERS_53
+#undef DMPACK_MEMBERS_54
+#undef DMPACK_MEMBERS_55
+#undef DMPACK_MEMBERS_56
+#undef DMPACK_MEMBERS_57
+#undef DMPACK_MEMBERS_58
+#undef DMPACK_MEMBERS_59
+#undef DMPACK_MEMBERS_60
+#undef DMPACK_MEMBERS_61
+#undef DMPACK_MEMBERS_62
+#undef DMPACK_MEMBERS_63
+#undef DMPACK_MEMBERS_64
+#undef DMPACK_MEMBERS_65
+#undef DMPACK_MEMBERS_66
+#undef DMPACK_MEMBERS_67
+#undef DMPACK_MEMBERS_68
+#undef DMPACK_MEMBERS_69
+#undef DMPACK_MEMBERS_70
+#undef DMPACK_MEMBERS_71
+#undef DMPACK_MEMBERS_72
+#undef DMPACK_MEMBERS_73
+#undef DMPACK_MEMBERS_74
+#undef DMPACK_MEMBERS_75
+#undef DMPACK_MEMBERS_76
+#undef DMPACK_MEMBERS_77
+#undef DMPACK_MEMBERS_78
+#undef DMPACK_MEMBERS_79
+#undef DMPACK_MEMBERS_80
+#undef DMPACK_MEMBERS_81
+#undef DMPACK_MEMBERS_82
+#undef DMPACK_MEMBERS_83
+#undef DMPACK_MEMBERS_84
+#undef DMPACK_MEMBERS_85
+#undef DMPACK_MEMBERS_86
+#undef DMPACK_MEMBERS_87
+#undef DMPACK_MEMBERS_88
+#undef DMPACK_MEMBERS_89
+#undef DMPACK_MEMBERS_90
+#undef DMPACK_MEMBERS_91
+#undef DMPACK_MEMBERS_92
+#undef DMPACK_MEMBERS_93
+#undef DMPACK_MEMBERS_94
+#undef DMPACK_MEMBERS_95
+#undef DMPACK_MEMBERS_96
+#undef DMPACK_MEMBERS_97
+#undef DMPACK_MEMBERS_98
+#undef DMPACK_MEMBERS_99
+#undef DMPACK_MEMBERS_100
+#undef DMPACK_MEMBERS_101
+#undef DMPACK_MEMBERS_102
+#undef DMPACK_MEMBERS_103
+#undef DMPACK_MEMBERS_104
+#undef DMPACK_MEMBERS_105
+#undef DMPACK_MEMBERS_106
+#undef DMPACK_MEMBERS_107
+#undef DMPACK_MEMBERS_108
+#undef DMPACK_MEMBERS_109
+#undef DMPACK_MEMBERS_110
+#undef DMPACK_MEMBERS_111
+#undef DMPACK_MEMBERS_112
+#undef DMPACK_MEMBERS_113
+#undef DMPACK_MEMBERS_114
+#undef DMPACK_MEMBERS_115
+#undef DMPACK_MEMBERS_116
+#undef DMPACK_MEMBERS_117
+#undef DMPACK_MEMBERS_118
+#undef DMPACK_MEMBERS_119
+#undef DMPACK_MEMBERS_120
+#undef DMPACK_MEMBERS_121
+#undef DMPACK_MEMBERS_122
+#undef DMPACK_MEMBERS_123
+#undef DMPACK_MEMBERS_124
+#undef DMPACK_MEMBERS_125
+#undef DMPACK_MEMBERS_126
+#undef DMPACK_MEMBERS_127
+#undef DMPACK_MEMBERS_128
+#undef DMPACK_MEMBERS_129
+#undef DMPACK_MEMBERS_130
+#undef DMPACK_MEMBERS_131
+#undef DMPACK_MEMBERS_132
+#undef DMPACK_MEMBERS_133
+#undef DMPACK_MEMBERS_134
+#undef DMPACK_MEMBERS_135
+#undef DMPACK_MEMBERS_136
+#undef DMPACK_MEMBERS_137
+#undef DMPACK_MEMBERS_138
+#undef DMPACK_MEMBERS_139
+#undef DMPACK_MEMBERS_140
+#undef DMPACK_MEMBERS_141
+#undef DMPACK_MEMBERS_142
+#undef DMPACK_MEMBERS_143
+#undef DMPACK_MEMBERS_144
+#undef DMPACK_MEMBERS_145
+#undef DMPACK_MEMBERS_146
+#undef DMPACK_MEMBERS_147
+#undef DMPACK_MEMBERS_148
+#undef DMPACK_MEMBERS_149
+#undef DMPACK_MEMBERS_150
+#undef DMPACK_MEMBERS_151
+#undef DMPACK_MEMBERS_152
+#undef DMPACK_MEMBERS_153
+#undef DMPACK_MEMBERS_154
+#undef DMPACK_MEMBERS_155
+#undef DMPACK_MEMBERS_156
+#undef DMPACK_MEMBERS_157
+#undef DMPACK_MEMBERS_158
+#undef DMPACK_MEMBERS_159
+#undef DMPACK_MEMBERS_160
+#undef DMPACK_MEMBERS_161
+#undef DMPACK_MEMBERS_162
+#undef DMPACK_MEMBERS_163
+#undef DMPACK_MEMBERS_164
+#undef DMPACK_MEMBERS_165
+#undef DMPACK_MEMBERS_166
+#undef DMPACK_MEMBERS_167
+#undef DMPACK_MEMBERS_168
+#undef DMPACK_MEMBERS_169
+#undef DMPACK_MEMBERS_170
+#undef DMPACK_MEMBERS_171
+#undef DMPACK_MEMBERS_172
+#undef DMPACK_MEMBERS_173
+#undef DMPACK_MEMBERS_174
+#undef DMPACK_MEMBERS_175
+#undef DMPACK_MEMBERS_176
+#undef DMPACK_MEMBERS_177
+#undef DMPACK_MEMBERS_178
+#undef DMPACK_MEMBERS_179
+#undef DMPACK_MEMBERS_180
+#undef DMPACK_MEMBERS_181
+#undef DMPACK_MEMBERS_182
+#undef DMPACK_MEMBERS_183
+#undef DMPACK_MEMBERS_184
+#undef DMPACK_MEMBERS_185
+#undef DMPACK_MEMBERS_186
+#undef DMPACK_MEMBERS_187
+#undef DMPACK_MEMBERS_188
+#undef DMPACK_MEMBERS_189
+#undef DMPACK_MEMBERS_190
+#undef DMPACK_MEMBERS_191
+#undef DMPACK_MEMBERS_192
+#undef DMPACK_MEMBERS_193
+#undef DMPACK_MEMBERS_194
+#undef DMPACK_MEMBERS_195
+#undef DMPACK_MEMBERS_196
+#undef DMPACK_MEMBERS_197
+#undef DMPACK_MEMBERS_198
+#undef DMPACK_MEMBERS_199
+#undef DMPACK_MEMBERS_200
+#undef DMPACK_MEMBERS_201
+#undef DMPACK_MEMBERS_202
+#undef DMPACK_MEMBERS_203
+#undef DMPACK_MEMBERS_204
+#undef DMPACK_MEMBERS_205
+#undef DMPACK_MEMBERS_206
+#undef DMPACK_MEMBERS_207
+#undef DMPACK_MEMBERS_208
+#undef DMPACK_MEMBERS_209
+#undef DMPACK_MEMBERS_210
+#undef DMPACK_MEMBERS_211
+#undef DMPACK_MEMBERS_212
+#undef DMPACK_MEMBERS_213
+#undef DMPACK_MEMBERS_214
+#undef DMPACK_MEMBERS_215
+#undef DMPACK_MEMBERS_216
+#undef DMPACK_MEMBERS_217
+#undef DMPACK_MEMBERS_218
+#undef DMPACK_MEMBERS_219
+#undef DMPACK_MEMBERS_220
+#undef DMPACK_MEMBERS_221
+#undef DMPACK_MEMBERS_222
+#undef DMPACK_MEMBERS_223
+#undef DMPACK_MEMBERS_224
+#undef DMPACK_MEMBERS_225
+#undef DMPACK_MEMBERS_226
+#undef DMPACK_MEMBERS_227
+#undef DMPACK_MEMBERS_228
+#undef DMPACK_MEMBERS_229
+#undef DMPACK_MEMBERS_230
+#undef DMPACK_MEMBERS_231
+#undef DMPACK_MEMBERS_232
+#undef DMPACK_MEMBERS_233
+#undef DMPACK_MEMBERS_234
+#undef DMPACK_MEMBERS_235
+#undef DMPACK_MEMBERS_236
+#undef DMPACK_MEMBERS_237
+#undef DMPACK_MEMBERS_238
+#undef DMPACK_MEMBERS_239
+#undef DMPACK_MEMBERS_240
+#undef DMPACK_MEMBERS_241
+#undef DMPACK_MEMBERS_242
+#undef DMPACK_MEMBERS_243
+#undef DMPACK_MEMBERS_244
+#undef DMPACK_MEMBERS_245
+#undef DMPACK_MEMBERS_246
+#undef DMPACK_MEMBERS_247
+#undef DMPACK_MEMBERS_248
+#undef DMPACK_MEMBERS_249
+#undef DMPACK_MEMBERS_250
+#undef DMPACK_MEMBERS_251
+#undef DMPACK_MEMBERS_252
+#undef DMPACK_MEMBERS_253
+#undef DMPACK_MEMBERS_254
+#undef DMPACK_MEMBERS_255
+#undef DMPACK_MEMBERS_256
+#undef DMPACK_MEMBERS_BLOCK_0
+#undef DMPACK_MEMBERS_BLOCK_1
+#undef DMPACK_MEMBERS_BLOCK_2
+#undef DMPACK_MEMBERS_BLOCK_3
+#undef DMPACK_MEMBERS_BLOCK_4
+#undef DMPACK_MEMBERS_BLOCK_5
+#undef DMPACK_MEMBERS_BLOCK_6
+#undef DMPACK_MEMBERS_BLOCK_7
+#undef DMPACK_MEMBERS_BLOCK_8
+#undef DMPACK_MEMBERS_BLOCK_9
+#undef DMPACK_MEMBERS_BLOCK_10
+#undef DMPACK_MEMBERS_BLOCK_11
+#undef DMPACK_MEMBERS_BLOCK_12
+#undef DMPACK_MEMBERS_BLOCK_13
+#undef DMPACK_MEMBERS_BLOCK_14
+#undef DMPACK_MEMBERS_BLOCK_15
 
         template <typename T, typename Visitor>
         constexpr decltype(auto) DMPACK_INLINE visit_members(T&& object,
@@ -123,522 +783,63 @@ namespace dm::pack {
                 static_assert(!sizeof(type), "empty struct/class is not allowed!");
             }
             static_assert(Count <= MaxVisitMembers, "exceed max visit members");
-            if constexpr (Count == 0) {
-                return visitor();
-            }
-            else if constexpr (Count == 1) {
-                auto&& [a1] = object;
-                return visitor(a1);
-            }
-            else if constexpr (Count == 2) {
-                auto&& [a1, a2] = object;
-                return visitor(a1, a2);
-            }
-            else if constexpr (Count == 3) {
-                auto&& [a1, a2, a3] = object;
-                return visitor(a1, a2, a3);
-            }
-            else if constexpr (Count == 4) {
-                auto&& [a1, a2, a3, a4] = object;
-                return visitor(a1, a2, a3, a4);
-            }
-            else if constexpr (Count == 5) {
-                auto&& [a1, a2, a3, a4, a5] = object;
-                return visitor(a1, a2, a3, a4, a5);
-            }
-            else if constexpr (Count == 6) {
-                auto&& [a1, a2, a3, a4, a5, a6] = object;
-                return visitor(a1, a2, a3, a4, a5, a6);
-            }
-            else if constexpr (Count == 7) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7);
-            }
-            else if constexpr (Count == 8) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8);
-            }
-            else if constexpr (Count == 9) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9);
-            }
-            else if constexpr (Count == 10) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
-            }
-            else if constexpr (Count == 11) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
-            }
-            else if constexpr (Count == 12) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
-            }
-            else if constexpr (Count == 13) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13);
-            }
-            else if constexpr (Count == 14) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14] =
-                    object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
-            }
-            else if constexpr (Count == 15) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15] =
-                    object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15);
-            }
-            else if constexpr (Count == 16) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16);
-            }
-            else if constexpr (Count == 17) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17);
-            }
-            else if constexpr (Count == 18) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18);
-            }
-            else if constexpr (Count == 19) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19);
-            }
-            else if constexpr (Count == 20) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20);
-            }
-            else if constexpr (Count == 21) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21);
-            }
-            else if constexpr (Count == 22) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22);
-            }
-            else if constexpr (Count == 23) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23);
-            }
-            else if constexpr (Count == 24) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24);
-            }
-            else if constexpr (Count == 25) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25);
-            }
-            else if constexpr (Count == 26) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26);
-            }
-            else if constexpr (Count == 27) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27] =
-                    object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27);
-            }
-            else if constexpr (Count == 28) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28] =
-                    object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28);
-            }
-            else if constexpr (Count == 29) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29);
-            }
-            else if constexpr (Count == 30) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30);
-            }
-            else if constexpr (Count == 31) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31);
-            }
-            else if constexpr (Count == 32) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32);
-            }
-            else if constexpr (Count == 33) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33);
-            }
-            else if constexpr (Count == 34) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34);
-            }
-            else if constexpr (Count == 35) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35);
-            }
-            else if constexpr (Count == 36) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36);
-            }
-            else if constexpr (Count == 37) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37);
-            }
-            else if constexpr (Count == 38) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38);
-            }
-            else if constexpr (Count == 39) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39);
-            }
-            else if constexpr (Count == 40) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40] =
-                    object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40);
-            }
-            else if constexpr (Count == 41) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41] =
-                    object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41);
-            }
-            else if constexpr (Count == 42) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42);
-            }
-            else if constexpr (Count == 43) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43);
-            }
-            else if constexpr (Count == 44) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44);
-            }
-            else if constexpr (Count == 45) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45);
-            }
-            else if constexpr (Count == 46) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46);
-            }
-            else if constexpr (Count == 47) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47);
-            }
-            else if constexpr (Count == 48) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48);
-            }
-            else if constexpr (Count == 49) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49);
-            }
-            else if constexpr (Count == 50) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50);
-            }
-            else if constexpr (Count == 51) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51);
-            }
-            else if constexpr (Count == 52) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52);
-            }
-            else if constexpr (Count == 53) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53] =
-                    object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53);
-            }
-            else if constexpr (Count == 54) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54] =
-                    object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54);
-            }
-            else if constexpr (Count == 55) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55);
-            }
-            else if constexpr (Count == 56) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56);
-            }
-            else if constexpr (Count == 57) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56, a57] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56, a57);
-            }
-            else if constexpr (Count == 58) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56, a57, a58] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56, a57, a58);
-            }
-            else if constexpr (Count == 59) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56, a57, a58, a59] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56, a57, a58, a59);
-            }
-            else if constexpr (Count == 60) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56, a57, a58, a59, a60] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56, a57, a58, a59, a60);
-            }
-            else if constexpr (Count == 61) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56, a57, a58, a59, a60, a61] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61);
-            }
-            else if constexpr (Count == 62) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56, a57, a58, a59, a60, a61, a62] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62);
-            }
-            else if constexpr (Count == 63) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56, a57, a58, a59, a60, a61, a62, a63] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62,
-                    a63);
-            }
-            else if constexpr (Count == 64) {
-                auto&& [a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15,
-                    a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28,
-                    a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41,
-                    a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52, a53, a54,
-                    a55, a56, a57, a58, a59, a60, a61, a62, a63, a64] = object;
-                return visitor(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
-                    a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26,
-                    a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38,
-                    a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50,
-                    a51, a52, a53, a54, a55, a56, a57, a58, a59, a60, a61, a62,
-                    a63, a64);
-            }
+            return members_visitor<Count>::visit(object, visitor);
+        }
+
+#if DMPACK_HAS_MEMBER_NAMES
+        // 只声明不定义: 仅在常量求值中取其成员地址，不要求 T 可默认构造，也不会产生链接依赖
+        template <typename T>
+        struct fake_object_wrapper {
+            T value;
+        };
+
+#if defined __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wundefined-var-template"
+#endif
+        template <typename T>
+        extern const fake_object_wrapper<T> fake_object;
+
+        template <typename T>
+        constexpr auto member_pointers() {
+            auto to_pointers = [](const auto&... members) { return std::make_tuple(&members...); };
+            return members_visitor<member_count<T>()>::visit(fake_object<T>.value, to_pointers);
         }
+#if defined __clang__
+#pragma clang diagnostic pop
+#endif
+
+        // 以成员地址实例化，从编译器签名的末尾取出成员名:
+        //   gcc:   [with auto Ptr = (& fake_object<Foo>.fake_object_wrapper<Foo>::value.Foo::bar)]
+        //   clang: [Ptr = &fake_object.value.bar]
+        //   msvc:  get_raw_member_name<&fake_object<Foo>.value->bar>(void)
+        template <auto Ptr>
+        constexpr auto get_raw_member_name() {
+#if defined(__clang__)
+            constexpr std::string_view suffix = "]";
+            constexpr std::string_view function = __PRETTY_FUNCTION__;
+#elif defined(__GNUC__)
+            constexpr std::string_view suffix = ")]";
+            constexpr std::string_view function = __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+            constexpr std::string_view suffix = ">(void)";
+            constexpr std::string_view function = __FUNCSIG__;
+#endif
+            constexpr std::size_t end = function.rfind(suffix);
+            std::size_t start = end;
+            while (start > 0) {
+                char c = function[start - 1];
+                if (!(c == '_' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))) { break; }
+                --start;
+            }
+            return function.substr(start, end - start);
+        }
+
+        template <typename T, std::size_t... I>
+        constexpr auto member_names(std::index_sequence<I...>) {
+            return std::array<std::string_view, sizeof...(I)>{ get_raw_member_name<std::get<I>(member_pointers<T>())>()... };
+        }
+#endif
 
         template <template <size_t index, typename... Args> typename Func,
             typename... Args>
@@ -1167,6 +1368,29 @@ namespace dm::pack {
 template <typename T>
 inline constexpr std::size_t dm_member_count_v = dm::pack::detail::member_count<T>();
 
+#if DMPACK_HAS_MEMBER_NAMES
+/**
+ * @brief 聚合体各成员的名字 (C++20)，按声明顺序排列，无需 dmgen4meta 生成的 dm::refl::traits。
+ */
+template <typename T>
+inline constexpr std::array<std::string_view, dm_member_count_v<T>> dm_member_names_v =
+    dm::pack::detail::member_names<T>(std::make_index_sequence<dm_member_count_v<T>>());
+
+template <typename T, std::size_t Index>
+inline constexpr std::string_view dm_member_name_v = dm_member_names_v<T>[Index];
+
+/**
+ * @brief 按名字查找成员的序号，找不到时返回 dm_member_count_v<T>；实参为常量时在编译期求值。
+ */
+template <typename T>
+constexpr std::size_t dm_member_index(std::string_view name) {
+    for (std::size_t i = 0; i < dm_member_names_v<T>.size(); ++i) {
+        if (dm_member_names_v<T>[i] == name) { return i; }
+    }
+    return dm_member_count_v<T>;
+}
+#endif
+
 template<typename T, typename Visitor>
 constexpr decltype(auto) dm_visit_members(T&& object, Visitor&& visitor) {
     return dm::pack::detail::visit_members(std::forward<T>(object), std::forward<Visitor>(visitor));
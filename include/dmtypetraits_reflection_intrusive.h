@@ -8,6 +8,11 @@
 #include <string>        // 包含进来以备后用
 #include <string_view>   // 包含进来以备后用
 #include <any>           // 包含进来以备后用
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <variant>
 #include "dmtypetraits_extensions.h"
 
 namespace dm::refl {
@@ -173,27 +178,126 @@ constexpr void visit_fields(T&& obj, Visitor&& visitor) {
 }
 
 
-template<typename T, typename Fields, size_t... Is>
-constexpr auto find_field_impl(std::string_view name, Fields&& fields, std::index_sequence<Is...>) {
-    // 注意: 此处实现仍有潜在bug（只能返回与第一个字段相同类型的描述符）
-    // 我们将在下一步骤中解决它。
-    using FieldType = std::decay_t<decltype(std::get<0>(fields))>;
-    std::optional<FieldType> result;
+namespace detail {
 
-    auto check_field = [&](const auto& field) {
-        if (field.name() == name && !result.has_value()) {
-            result.emplace(field);
+// 带种子的 FNV-1a，名字只需扫描一遍；槽位由这个 64 位值再混合得到
+constexpr uint64_t name_hash(std::string_view name) {
+    uint64_t h = 14695981039346656037ull;
+    for (char c : name) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+constexpr uint64_t mix_hash(uint64_t h, uint64_t seed) {
+    h += seed * 0x9e3779b97f4a7c15ull;
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+    return h ^ (h >> 31);
+}
+
+constexpr size_t perfect_hash_slots(size_t n) {
+    size_t m = 1;
+    while (m < n) { m <<= 1; }
+    return m;
+}
+
+// 编译期生成的完美哈希 (hash and displace): 名字先按哈希分到 N 个桶，
+// 每个桶选一个位移种子使桶内名字落到互不冲突的空槽；查找只需一次哈希和一次名字比较
+template<size_t N>
+struct perfect_hash {
+    static constexpr size_t slot_count = perfect_hash_slots(N);
+    static constexpr size_t npos = N;
+
+    std::array<uint32_t, (N > 0 ? N : 1)> seeds{};
+    std::array<size_t, slot_count> slots{};
+
+    constexpr size_t find(uint64_t h) const {
+        if constexpr (N == 0) { return npos; }
+        else { return slots[mix_hash(h, seeds[h % N]) & (slot_count - 1)]; }
+    }
+};
+
+template<size_t N>
+constexpr perfect_hash<N> make_perfect_hash(const std::array<std::string_view, N>& names) {
+    perfect_hash<N> table{};
+    for (auto& slot : table.slots) { slot = N; }
+    if constexpr (N > 0) {
+        std::array<uint64_t, N> hashes{};
+        std::array<size_t, N> bucket_sizes{};
+        for (size_t i = 0; i < N; ++i) {
+            hashes[i] = name_hash(names[i]);
+            ++bucket_sizes[hashes[i] % N];
         }
-    };
+        // 大桶先放，越往后空槽越少，小桶越容易找到种子
+        std::array<bool, N> placed{};
+        for (size_t round = 0; round < N; ++round) {
+            size_t bucket = N;
+            for (size_t b = 0; b < N; ++b) {
+                if (!placed[b] && (bucket == N || bucket_sizes[b] > bucket_sizes[bucket])) { bucket = b; }
+            }
+            placed[bucket] = true;
+            if (bucket_sizes[bucket] == 0) { break; }
+            for (uint32_t seed = 0;; ++seed) {
+                if (seed == 1u << 20) { throw "dm::refl: no perfect hash seed found, field names collide"; }
+                std::array<size_t, N> taken{};
+                size_t count = 0;
+                bool ok = true;
+                for (size_t i = 0; i < N && ok; ++i) {
+                    if (hashes[i] % N != bucket) { continue; }
+                    size_t slot = mix_hash(hashes[i], seed) & (perfect_hash<N>::slot_count - 1);
+                    ok = table.slots[slot] == N;
+                    for (size_t k = 0; k < count && ok; ++k) { ok = taken[k] != slot; }
+                    taken[count++] = slot;
+                }
+                if (!ok) { continue; }
+                table.seeds[bucket] = seed;
+                count = 0;
+                for (size_t i = 0; i < N; ++i) {
+                    if (hashes[i] % N == bucket) { table.slots[taken[count++]] = i; }
+                }
+                break;
+            }
+        }
+    }
+    return table;
+}
 
-    (check_field(std::get<Is>(fields)), ...);
-    return result;
+template<typename T, size_t... Is>
+constexpr auto field_names_impl(std::index_sequence<Is...>) {
+    constexpr auto members = traits<T>::members();
+    return std::array<std::string_view, sizeof...(Is)>{ std::string_view(std::get<Is>(members).first)... };
 }
 
 template<typename T>
-constexpr auto find_field(std::string_view name) {
-    constexpr auto fields = type_info<T>::fields();
-    return find_field_impl<T>(name, fields, std::make_index_sequence<std::tuple_size_v<decltype(fields)>>{});
+struct field_lookup {
+    static constexpr size_t count = std::tuple_size_v<decltype(traits<T>::members())>;
+    static constexpr std::array<std::string_view, count> names = field_names_impl<T>(std::make_index_sequence<count>{});
+    static constexpr perfect_hash<count> table = make_perfect_hash(names);
+};
+
+template<typename Tuple>
+struct tuple_to_variant;
+
+template<typename... Ts>
+struct tuple_to_variant<std::tuple<Ts...>> {
+    using type = std::variant<Ts...>;
+};
+
+} // namespace detail
+
+/**
+ * @brief 按名字查找字段序号，找不到时返回 get_field_count<T>()。
+ *
+ * 名字经编译期生成的完美哈希直接定位到唯一候选字段，只需一次名字比较确认。
+ */
+template<typename T>
+constexpr size_t find_field_index(std::string_view name) {
+    using lookup = detail::field_lookup<T>;
+    size_t index = lookup::table.find(detail::name_hash(name));
+    if (index == lookup::count || lookup::names[index] != name) { return lookup::count; }
+    return index;
 }
 
 template<size_t Index, typename T>
@@ -203,6 +307,88 @@ constexpr auto get_field() {
     return std::get<Index>(fields);
 }
 
+template<typename T>
+using field_variant_t = typename detail::tuple_to_variant<decltype(type_info<T>::fields())>::type;
+
+namespace detail {
+
+template<typename T, size_t... Is>
+constexpr auto make_field_table(std::index_sequence<Is...>) {
+    using fn = field_variant_t<T>(*)();
+    return std::array<fn, sizeof...(Is)>{ [] { return field_variant_t<T>(std::in_place_index<Is>, get_field<Is, T>()); }... };
+}
+
+template<typename Object, typename Visitor, size_t... Is>
+constexpr auto make_visit_table(std::index_sequence<Is...>) {
+    using T = std::remove_const_t<Object>;
+    using fn = void(*)(Object&, Visitor&);
+    return std::array<fn, sizeof...(Is)>{ [](Object& obj, Visitor& visitor) {
+        constexpr auto field = get_field<Is, T>();
+        visitor(field, field.get(obj));
+    }... };
+}
+
+} // namespace detail
+
+/**
+ * @brief 按名字查找字段描述符；各字段的描述符类型不同，结果以 std::variant 返回。
+ */
+template<typename T>
+constexpr std::optional<field_variant_t<T>> find_field(std::string_view name) {
+    constexpr size_t count = detail::field_lookup<T>::count;
+    size_t index = find_field_index<T>(name);
+    if (index == count) { return std::nullopt; }
+    constexpr auto table = detail::make_field_table<T>(std::make_index_sequence<count>{});
+    return table[index]();
+}
+
+/**
+ * @brief 按名字访问一个字段: 以 (字段描述符, 字段值) 调用 visitor，经跳转表分派到该字段的类型。
+ * 找不到该名字时返回 false。
+ */
+template<typename T, typename Visitor>
+bool visit_field(T& obj, std::string_view name, Visitor&& visitor) {
+    using CleanT = std::remove_const_t<T>;
+    constexpr size_t count = detail::field_lookup<CleanT>::count;
+    size_t index = find_field_index<CleanT>(name);
+    if (index == count) { return false; }
+    using visitor_type = std::remove_reference_t<Visitor>;
+    static constexpr auto table = detail::make_visit_table<T, visitor_type>(std::make_index_sequence<count>{});
+    table[index](obj, visitor);
+    return true;
+}
+
+namespace detail {
+
+template<typename OutputIt>
+OutputIt format_chars(std::string_view text, OutputIt out) {
+    for (char c : text) { *out++ = c; }
+    return out;
+}
+
+template<typename V, typename OutputIt>
+OutputIt format_value(const V& value, OutputIt out) {
+    if constexpr (std::is_same_v<V, bool>) {
+        return format_chars(value ? "true" : "false", out);
+    }
+    else if constexpr (std::is_enum_v<V>) {
+        return format_value(static_cast<std::underlying_type_t<V>>(value), out);
+    }
+    else if constexpr (std::is_arithmetic_v<V>) {
+        char buffer[64];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        return format_chars(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)), out);
+    }
+    else if constexpr (std::is_convertible_v<const V&, std::string_view>) {
+        return format_chars(std::string_view(value), out);
+    }
+    else {
+        return format_chars("[complex_type]", out);
+    }
+}
+
+} // namespace detail
+
 template<typename T>
 class object_accessor {
 private:
@@ -219,38 +405,58 @@ public:
         constexpr auto field = get_field<Index, T>();
         field.set(*obj_, std::forward<U>(value));
     }
-    auto get(std::string_view name) const -> std::optional<std::string> {
-        bool found = false;
-        std::string result;
-        visit_fields(*obj_, [&](const auto& field, const auto& value) {
-            if (!found && field.name() == name) {
-                if constexpr (std::is_arithmetic_v<std::decay_t<decltype(value)>>) {
-                    result = std::to_string(value);
-                }
-                else if constexpr (std::is_convertible_v<decltype(value), std::string>) {
-                    result = value;
-                }
-                else {
-                    result = "[complex_type]";
-                }
-                found = true;
+    /**
+     * @brief 按名字取字段的指针，不分配内存；名字不存在或字段类型不是 U 时返回 nullptr。
+     */
+    template<typename U>
+    U* get(std::string_view name) const {
+        U* result = nullptr;
+        visit_field(*obj_, name, [&](const auto&, auto& value) {
+            if constexpr (std::is_same_v<std::remove_const_t<U>, std::decay_t<decltype(value)>>) {
+                result = &value;
             }
             });
-        return found ? std::optional<std::string>{result} : std::nullopt;
+        return result;
+    }
+
+    /**
+     * @brief 按名字以字段的实际类型调用 visitor(value)；名字不存在时返回 false。
+     */
+    template<typename Visitor>
+    bool visit(std::string_view name, Visitor&& visitor) const {
+        return visit_field(*obj_, name, [&](const auto&, auto& value) { visitor(value); });
+    }
+
+    /**
+     * @brief 按名字把字段的文本形式写到 out，数值经 std::to_chars 转换，不分配内存。
+     *
+     * 布尔写作 true/false，枚举写作底层整数，字符串原样写出，其它类型写作 [complex_type]。
+     * 返回写完后的迭代器；名字不存在时返回 std::nullopt。
+     */
+    template<typename OutputIt>
+    std::optional<OutputIt> format_to(std::string_view name, OutputIt out) const {
+        bool found = visit_field(*obj_, name, [&](const auto&, const auto& value) {
+            out = detail::format_value(value, out);
+            });
+        return found ? std::optional<OutputIt>{out} : std::nullopt;
+    }
+
+    auto get(std::string_view name) const -> std::optional<std::string> {
+        std::string result;
+        if (!format_to(name, std::back_inserter(result))) { return std::nullopt; }
+        return result;
     }
     template<typename U>
     bool set(std::string_view name, U&& value) const {
-        bool found = false;
-        visit_fields(*obj_, [&](const auto& field, auto& field_value) {
-            if (!found && field.name() == name) {
-                using FieldType = std::decay_t<decltype(field_value)>;
-                if constexpr (std::is_assignable_v<FieldType&, U>) {
-                    field.set(*obj_, std::forward<U>(value));
-                    found = true;
-                }
+        bool assigned = false;
+        visit_field(*obj_, name, [&](const auto& field, auto& field_value) {
+            using FieldType = std::decay_t<decltype(field_value)>;
+            if constexpr (std::is_assignable_v<FieldType&, U>) {
+                field.set(*obj_, std::forward<U>(value));
+                assigned = true;
             }
             });
-        return found;
+        return assigned;
     }
 };
 
@@ -0,0 +1,197 @@
+#ifndef __DMTYPETRAITS_REFLECTION_RUNTIME_H_INCLUDE__
+#define __DMTYPETRAITS_REFLECTION_RUNTIME_H_INCLUDE__
+
+#include "dmtypetraits_reflection_intrusive.h"
+#include "dmtypetraits_pack.h"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace dm::refl {
+
+/**
+ * @brief 字段值的大类，供不感知具体类型的工具 (管理台、DB 映射、对比) 选择展示与编辑方式。
+ */
+enum class field_kind : uint8_t {
+    boolean,
+    signed_integer,
+    unsigned_integer,
+    floating_point,
+    enumeration,
+    string,
+    optional,
+    sequence,
+    map,
+    object,
+    other,
+};
+
+/**
+ * @brief 一个字段的类型擦除描述: 名字、布局与按 void* 操作字段的函数。
+ *
+ * get/set 以同类型的值拷贝读写 (字段不可拷贝赋值时为 nullptr)；
+ * serialize 以 dm::pack 格式把字段追加到 out，deserialize 从 dm::pack 数据还原字段。
+ */
+struct field_info {
+    std::string_view name;                           // 聚合体在 C++17 下没有名字，为空
+    std::string_view type_name;
+    std::size_t offset;
+    std::size_t size;
+    field_kind kind;
+    void (*get)(const void* object, void* out);
+    void (*set)(void* object, const void* value);
+    void (*serialize)(const void* object, std::vector<char>& out);
+    std::errc (*deserialize)(void* object, const char* data, std::size_t size);
+
+    const void* address(const void* object) const { return static_cast<const char*>(object) + offset; }
+    void* address(void* object) const { return static_cast<char*>(object) + offset; }
+};
+
+/**
+ * @brief 一个类型的运行期字段表，每个类型只生成一次，之后的动态访问都是数组下标。
+ */
+struct runtime_type_info {
+    std::string_view name;
+    std::size_t size;
+    const field_info* fields;
+    std::size_t field_count;
+    std::size_t (*find_index)(std::string_view name);   // 找不到时返回 field_count
+
+    const field_info* begin() const { return fields; }
+    const field_info* end() const { return fields + field_count; }
+    const field_info& operator[](std::size_t index) const { return fields[index]; }
+
+    const field_info* find(std::string_view field_name) const {
+        std::size_t index = find_index(field_name);
+        return index < field_count ? fields + index : nullptr;
+    }
+};
+
+namespace detail {
+
+// 侵入式 traits<T> 优先，否则按聚合体反射访问第 I 个成员
+template<size_t I, typename T>
+decltype(auto) runtime_member(T& object) {
+    using CleanT = std::remove_const_t<T>;
+    if constexpr (is_reflectable_v<CleanT>) {
+        return object.*(std::get<I>(traits<CleanT>::members()).second);
+    }
+    else {
+        return ::dm_visit_members(object, [](auto&... members) -> decltype(auto) { return std::get<I>(std::tie(members...)); });
+    }
+}
+
+template<typename T>
+constexpr size_t runtime_field_count() {
+    if constexpr (is_reflectable_v<T>) { return get_field_count<T>(); }
+    else { return dm_member_count_v<T>; }
+}
+
+template<typename T, size_t I>
+constexpr std::string_view runtime_field_name() {
+    if constexpr (is_reflectable_v<T>) { return std::get<I>(traits<T>::members()).first; }
+#if DMPACK_HAS_MEMBER_NAMES
+    else { return dm_member_name_v<T, I>; }
+#else
+    else { return {}; }
+#endif
+}
+
+template<typename T>
+constexpr std::string_view runtime_type_name() {
+    if constexpr (is_reflectable_v<T>) { return traits<T>::name; }
+    else { return dm_type_name<T>(); }
+}
+
+template<typename F>
+constexpr field_kind get_field_kind() {
+    if constexpr (dm_is_same_v<F, bool>) { return field_kind::boolean; }
+    else if constexpr (dm_is_integral_v<F>) { return std::is_signed_v<F> ? field_kind::signed_integer : field_kind::unsigned_integer; }
+    else if constexpr (std::is_floating_point_v<F>) { return field_kind::floating_point; }
+    else if constexpr (dm_is_enum_v<F>) { return field_kind::enumeration; }
+    else if constexpr (dm_is_string_like_v<F>) { return field_kind::string; }
+    else if constexpr (dm_is_optional_v<F>) { return field_kind::optional; }
+    else if constexpr (dm_is_map_container_v<F>) { return field_kind::map; }
+    else if constexpr (dm_is_container_v<F> || std::is_array_v<F>) { return field_kind::sequence; }
+    else if constexpr (dm_is_class_v<F>) { return field_kind::object; }
+    else { return field_kind::other; }
+}
+
+template<typename T, size_t I>
+field_info make_runtime_field(const unsigned char* storage) {
+    using F = dm_remove_cvref_t<decltype(runtime_member<I>(std::declval<T&>()))>;
+    field_info info{};
+    info.name = runtime_field_name<T, I>();
+    info.type_name = dm_type_name<F>();
+    // 只取成员地址，不访问对象内容
+    info.offset = static_cast<std::size_t>(reinterpret_cast<const unsigned char*>(
+        &runtime_member<I>(*reinterpret_cast<const T*>(storage))) - storage);
+    info.size = sizeof(F);
+    info.kind = get_field_kind<F>();
+    if constexpr (std::is_copy_assignable_v<F>) {
+        info.get = [](const void* object, void* out) {
+            *static_cast<F*>(out) = runtime_member<I>(*static_cast<const T*>(object));
+        };
+        info.set = [](void* object, const void* value) {
+            runtime_member<I>(*static_cast<T*>(object)) = *static_cast<const F*>(value);
+        };
+    }
+    info.serialize = [](const void* object, std::vector<char>& out) {
+        dm::pack::serialize_to(out, runtime_member<I>(*static_cast<const T*>(object)));
+    };
+    info.deserialize = [](void* object, const char* data, std::size_t size) -> std::errc {
+        return dm::pack::deserialize_to(runtime_member<I>(*static_cast<T*>(object)), data, size);
+    };
+    return info;
+}
+
+template<typename T, size_t... Is>
+std::array<field_info, sizeof...(Is)> make_runtime_fields(std::index_sequence<Is...>) {
+    alignas(T) static unsigned char storage[sizeof(T)];
+    return { make_runtime_field<T, Is>(storage)... };
+}
+
+template<typename T>
+size_t runtime_find_index(std::string_view name) {
+    if constexpr (is_reflectable_v<T>) { return find_field_index<T>(name); }
+    else {
+        constexpr size_t count = runtime_field_count<T>();
+#if DMPACK_HAS_MEMBER_NAMES
+        for (size_t i = 0; i < count; ++i) {
+            if (dm_member_names_v<T>[i] == name) { return i; }
+        }
+#else
+        (void)name;
+#endif
+        return count;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief 取 T 的运行期字段表: 有 dm::refl::traits<T> 时按其字段 (带名字)，否则按聚合体成员。
+ *
+ * 字段表在首次调用时生成一次 (偏移量需要取成员地址，不能在编译期求出)，之后返回同一份数据；
+ * 各字段类型需要能被 dm::pack 序列化，不支持引用成员。
+ */
+template<typename T>
+const runtime_type_info& get_runtime_type_info() {
+    static_assert(dm_is_class_v<T>, "runtime_type_info requires a class type");
+    constexpr size_t count = detail::runtime_field_count<T>();
+    static const std::array<field_info, count> fields = detail::make_runtime_fields<T>(std::make_index_sequence<count>{});
+    static const runtime_type_info info{
+        detail::runtime_type_name<T>(),
+        sizeof(T),
+        fields.data(),
+        count,
+        &detail::runtime_find_index<T>,
+    };
+    return info;
+}
+
+} // namespace dm::refl
+
+#endif // __DMTYPETRAITS_REFLECTION_RUNTIME_H_INCLUDE__
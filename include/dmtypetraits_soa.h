@@ -0,0 +1,377 @@
+#ifndef __DMTYPETRAITS_SOA_H_INCLUDE__
+#define __DMTYPETRAITS_SOA_H_INCLUDE__
+
+#include "dmtypetraits_reflection.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace dm {
+
+    /**
+     * @brief 一列连续元素的视图 (C++17 下 std::span 的替代)。
+     */
+    template <typename U>
+    class soa_span {
+    public:
+        soa_span(U* data, std::size_t size) : data_(data), size_(size) {}
+
+        U* data() const { return data_; }
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        U* begin() const { return data_; }
+        U* end() const { return data_ + size_; }
+        U& operator[](std::size_t index) const { return data_[index]; }
+
+    private:
+        U* data_;
+        std::size_t size_;
+    };
+
+    namespace detail {
+
+        template <typename Tuple>
+        struct soa_columns;
+
+        template <typename... Ms>
+        struct soa_columns<std::tuple<Ms...>> {
+            using types = std::tuple<dm_remove_cvref_t<Ms>...>;
+            using pointers = std::tuple<dm_remove_cvref_t<Ms>*...>;
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief 按成员分列存放聚合体的容器: 每个成员一段连续数组，共用同一个长度与容量。
+     *
+     * 只扫描一两个成员时不必把整个结构体读进缓存，column<I>() 直接给出可向量化的连续数组。
+     * operator[] 返回代理引用，get<I>() 访问单个成员，也可整体读出/写入 T；
+     * 与 std::vector<T> 可互相转换。成员不能是引用或 C 数组。
+     */
+    template <typename T>
+    class soa_vector {
+        using tuple_type = decltype(dm_struct_to_tuple(std::declval<T&>()));
+        using columns = detail::soa_columns<tuple_type>;
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using column_types = typename columns::types;
+
+        static constexpr std::size_t column_count = std::tuple_size_v<column_types>;
+
+        template <std::size_t I>
+        using column_type = std::tuple_element_t<I, column_types>;
+
+        template <bool Const>
+        class basic_reference {
+            using owner = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+        public:
+            basic_reference(owner& vec, std::size_t index) : vec_(&vec), index_(index) {}
+
+            template <std::size_t I>
+            auto& get() const { return vec_->template data<I>()[index_]; }
+
+            operator T() const { return vec_->load(index_); }
+
+            template <bool C = Const, typename = std::enable_if_t<!C>>
+            const basic_reference& operator=(const T& value) const {
+                vec_->store(index_, value);
+                return *this;
+            }
+
+        private:
+            owner* vec_;
+            std::size_t index_;
+        };
+
+        using reference = basic_reference<false>;
+        using const_reference = basic_reference<true>;
+
+        template <bool Const>
+        class basic_iterator {
+            using owner = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = basic_reference<Const>;
+            using pointer = void;
+
+            basic_iterator(owner& vec, std::size_t index) : vec_(&vec), index_(index) {}
+
+            reference operator*() const { return reference(*vec_, index_); }
+            reference operator[](difference_type n) const { return reference(*vec_, index_ + n); }
+            basic_iterator& operator++() { ++index_; return *this; }
+            basic_iterator operator++(int) { basic_iterator it = *this; ++index_; return it; }
+            basic_iterator& operator--() { --index_; return *this; }
+            basic_iterator operator--(int) { basic_iterator it = *this; --index_; return it; }
+            basic_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+            basic_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+            basic_iterator operator+(difference_type n) const { return basic_iterator(*vec_, index_ + n); }
+            basic_iterator operator-(difference_type n) const { return basic_iterator(*vec_, index_ - n); }
+            difference_type operator-(const basic_iterator& other) const {
+                return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+            }
+            bool operator==(const basic_iterator& other) const { return index_ == other.index_; }
+            bool operator!=(const basic_iterator& other) const { return index_ != other.index_; }
+            bool operator<(const basic_iterator& other) const { return index_ < other.index_; }
+
+        private:
+            owner* vec_;
+            std::size_t index_;
+        };
+
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        soa_vector() = default;
+
+        explicit soa_vector(const std::vector<T>& values) {
+            try {
+                reserve(values.size());
+                for (const T& value : values) { push_back(value); }
+            }
+            catch (...) {
+                release();
+                throw;
+            }
+        }
+
+        soa_vector(const soa_vector& other) {
+            reserve(other.size_);
+            try {
+                copy_columns(other, std::make_index_sequence<column_count>());
+            }
+            catch (...) {
+                release();
+                throw;
+            }
+            size_ = other.size_;
+        }
+
+        soa_vector(soa_vector&& other) noexcept
+            : data_(std::exchange(other.data_, {})), size_(std::exchange(other.size_, 0)),
+              capacity_(std::exchange(other.capacity_, 0)) {}
+
+        soa_vector& operator=(soa_vector other) noexcept {
+            swap(other);
+            return *this;
+        }
+
+        ~soa_vector() { release(); }
+
+        void swap(soa_vector& other) noexcept {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+        }
+
+        std::size_t size() const { return size_; }
+        std::size_t capacity() const { return capacity_; }
+        bool empty() const { return size_ == 0; }
+
+        void reserve(std::size_t capacity) {
+            if (capacity <= capacity_) { return; }
+            pointers grown{};
+            grow_columns(grown, capacity, std::make_index_sequence<column_count>());
+            data_ = grown;
+            capacity_ = capacity;
+        }
+
+        void clear() {
+            for_each_column([&](auto* column, auto) { std::destroy(column, column + size_); });
+            size_ = 0;
+        }
+
+        void push_back(const T& value) {
+            grow_for_one();
+            construct_at_end(dm_struct_to_tuple(value), std::make_index_sequence<column_count>());
+            ++size_;
+        }
+
+        void push_back(T&& value) {
+            grow_for_one();
+            construct_at_end(dm_struct_to_tuple(value), std::make_index_sequence<column_count>(), std::true_type{});
+            ++size_;
+        }
+
+        void pop_back() {
+            --size_;
+            for_each_column([&](auto* column, auto) { std::destroy_at(column + size_); });
+        }
+
+        /**
+         * @brief 删除第 index 个元素，后面的元素依次前移 (保持顺序)。
+         */
+        void erase(std::size_t index) {
+            for_each_column([&](auto* column, auto) {
+                std::move(column + index + 1, column + size_, column + index);
+            });
+            pop_back();
+        }
+
+        reference operator[](std::size_t index) { return reference(*this, index); }
+        const_reference operator[](std::size_t index) const { return const_reference(*this, index); }
+
+        iterator begin() { return iterator(*this, 0); }
+        iterator end() { return iterator(*this, size_); }
+        const_iterator begin() const { return const_iterator(*this, 0); }
+        const_iterator end() const { return const_iterator(*this, size_); }
+
+        /**
+         * @brief 第 I 个成员的整列。
+         */
+        template <std::size_t I>
+        soa_span<column_type<I>> column() { return { data<I>(), size_ }; }
+
+        template <std::size_t I>
+        soa_span<const column_type<I>> column() const { return { data<I>(), size_ }; }
+
+        template <std::size_t I>
+        column_type<I>* data() { return std::get<I>(data_); }
+
+        template <std::size_t I>
+        const column_type<I>* data() const { return std::get<I>(data_); }
+
+        T load(std::size_t index) const { return load(index, std::make_index_sequence<column_count>()); }
+
+        void store(std::size_t index, const T& value) {
+            store(index, dm_struct_to_tuple(value), std::make_index_sequence<column_count>());
+        }
+
+        std::vector<T> to_vector() const {
+            std::vector<T> values;
+            values.reserve(size_);
+            for (std::size_t i = 0; i < size_; ++i) { values.push_back(load(i)); }
+            return values;
+        }
+
+    private:
+        using pointers = typename columns::pointers;
+
+        template <typename U>
+        static U* allocate(std::size_t n) { return std::allocator<U>().allocate(n); }
+
+        template <typename U>
+        static void deallocate(U* p, std::size_t n) {
+            if (p != nullptr) { std::allocator<U>().deallocate(p, n); }
+        }
+
+        template <typename F>
+        void for_each_column(F&& f) const {
+            for_each_column(f, std::make_index_sequence<column_count>());
+        }
+
+        template <typename F, std::size_t... I>
+        void for_each_column(F& f, std::index_sequence<I...>) const {
+            (f(std::get<I>(data_), std::integral_constant<std::size_t, I>()), ...);
+        }
+
+        void release() noexcept {
+            clear();
+            deallocate_columns(data_, capacity_, std::make_index_sequence<column_count>());
+        }
+
+        // 异常回滚: 销毁 columns 前 count 列的 [first, last)
+        template <std::size_t... I>
+        static void destroy_columns(const pointers& columns, std::size_t count, std::size_t first, std::size_t last,
+            std::index_sequence<I...>) {
+            ((I < count ? std::destroy(std::get<I>(columns) + first, std::get<I>(columns) + last) : void()), ...);
+        }
+
+        template <std::size_t... I>
+        static void deallocate_columns(const pointers& columns, std::size_t capacity, std::index_sequence<I...>) {
+            (deallocate(std::get<I>(columns), capacity), ...);
+        }
+
+        // 与 std::vector 相同: 只要有一列的移动构造可能抛出，可复制的列都改为复制，扩容失败时原有元素保持不变
+        template <bool MoveAll, typename U>
+        static void relocate(U* first, U* last, U* dest) {
+            if constexpr (MoveAll || !std::is_copy_constructible_v<U>) {
+                std::uninitialized_move(first, last, dest);
+            }
+            else {
+                std::uninitialized_copy(first, last, dest);
+            }
+        }
+
+        template <std::size_t... I>
+        void grow_columns(pointers& grown, std::size_t capacity, std::index_sequence<I...>) {
+            static_assert(((!std::is_array_v<column_type<I>>) && ...), "C array members are not supported by soa_vector");
+            constexpr bool move_all = (std::is_nothrow_move_constructible_v<column_type<I>> && ...);
+            std::size_t moved = 0;
+            try {
+                ((std::get<I>(grown) = allocate<column_type<I>>(capacity)), ...);
+                ((relocate<move_all>(std::get<I>(data_), std::get<I>(data_) + size_, std::get<I>(grown)), ++moved), ...);
+            }
+            catch (...) {
+                destroy_columns(grown, moved, 0, size_, std::index_sequence<I...>());
+                deallocate_columns(grown, capacity, std::index_sequence<I...>());
+                throw;
+            }
+            ((std::destroy(std::get<I>(data_), std::get<I>(data_) + size_), deallocate(std::get<I>(data_), capacity_)), ...);
+        }
+
+        template <std::size_t... I>
+        void copy_columns(const soa_vector& other, std::index_sequence<I...>) {
+            std::size_t copied = 0;
+            try {
+                ((std::uninitialized_copy(std::get<I>(other.data_), std::get<I>(other.data_) + other.size_, std::get<I>(data_)),
+                  ++copied), ...);
+            }
+            catch (...) {
+                destroy_columns(data_, copied, 0, other.size_, std::index_sequence<I...>());
+                throw;
+            }
+        }
+
+        void grow_for_one() {
+            if (size_ == capacity_) { reserve(capacity_ == 0 ? 8 : capacity_ * 2); }
+        }
+
+        template <typename Tuple, std::size_t... I, typename Move = std::false_type>
+        void construct_at_end(Tuple&& members, std::index_sequence<I...>, Move = {}) {
+            std::size_t constructed = 0;
+            try {
+                if constexpr (Move::value) {
+                    ((::new (static_cast<void*>(std::get<I>(data_) + size_)) column_type<I>(std::move(std::get<I>(members))),
+                      ++constructed), ...);
+                }
+                else {
+                    ((::new (static_cast<void*>(std::get<I>(data_) + size_)) column_type<I>(std::get<I>(members)),
+                      ++constructed), ...);
+                }
+            }
+            catch (...) {
+                // 已在前面几列构造的元素不计入 size_，需要在这里销毁
+                destroy_columns(data_, constructed, size_, size_ + 1, std::index_sequence<I...>());
+                throw;
+            }
+        }
+
+        template <std::size_t... I>
+        T load(std::size_t index, std::index_sequence<I...>) const {
+            return T{ std::get<I>(data_)[index]... };
+        }
+
+        template <typename Tuple, std::size_t... I>
+        void store(std::size_t index, Tuple&& members, std::index_sequence<I...>) {
+            ((std::get<I>(data_)[index] = std::get<I>(members)), ...);
+        }
+
+        pointers data_{};
+        std::size_t size_ = 0;
+        std::size_t capacity_ = 0;
+    };
+
+} // namespace dm
+
+#endif // __DMTYPETRAITS_SOA_H_INCLUDE__
@@ -0,0 +1,318 @@
+#ifndef __DMTYPETRAITS_SPLIT_H_INCLUDE__
+#define __DMTYPETRAITS_SPLIT_H_INCLUDE__
+
+#include "dmtypetraits_reflection.h"
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace dm {
+
+    namespace detail {
+
+        template <typename T>
+        using split_members_t = decltype(dm_struct_to_tuple(std::declval<T&>()));
+
+        template <typename T, std::size_t I>
+        using split_member_t = dm_remove_cvref_t<std::tuple_element_t<I, split_members_t<T>>>;
+
+        template <std::size_t N, std::size_t... Hot>
+        struct split_layout {
+            static constexpr std::size_t hot_count = sizeof...(Hot);
+            static constexpr std::size_t cold_count = N - hot_count;
+
+            static constexpr std::array<bool, N> make_hot_mask() {
+                std::array<bool, N> mask{};
+                ((mask[Hot] = true), ...);
+                return mask;
+            }
+
+            static constexpr std::array<bool, N> hot_mask = make_hot_mask();
+
+            // 成员在热行或冷行中的位置: 热成员按 Hot... 的顺序，冷成员按声明顺序
+            static constexpr std::array<std::size_t, N> make_slots() {
+                std::array<std::size_t, N> slots{};
+                std::size_t k = 0;
+                ((slots[Hot] = k++), ...);
+                k = 0;
+                for (std::size_t i = 0; i < N; ++i) {
+                    if (!hot_mask[i]) { slots[i] = k++; }
+                }
+                return slots;
+            }
+
+            static constexpr std::array<std::size_t, N> slots = make_slots();
+
+            static constexpr std::array<std::size_t, (cold_count > 0 ? cold_count : 1)> make_cold_indices() {
+                std::array<std::size_t, (cold_count > 0 ? cold_count : 1)> cold{};
+                std::size_t k = 0;
+                for (std::size_t i = 0; i < N; ++i) {
+                    if (!hot_mask[i]) { cold[k++] = i; }
+                }
+                return cold;
+            }
+
+            static constexpr auto cold_indices = make_cold_indices();
+
+            static constexpr bool valid() {
+                std::size_t marked = 0;
+                for (bool hot : hot_mask) { marked += hot ? 1 : 0; }
+                return ((Hot < N) && ...) && marked == hot_count;
+            }
+        };
+
+        template <typename T, typename Layout, typename Seq>
+        struct split_cold_row;
+
+        template <typename T, typename Layout, std::size_t... K>
+        struct split_cold_row<T, Layout, std::index_sequence<K...>> {
+            using type = std::tuple<split_member_t<T, Layout::cold_indices[K]>...>;
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief 冷热分离的聚合体容器: Hot... 指定的成员按行紧凑存放在一个数组里，其余成员放在旁边的冷表。
+     *
+     * 每帧只读写热成员的循环 (for_each_hot / hot_rows) 只触及热数组所在的缓存行；
+     * 按下标访问时 get<I>(i) 把成员序号映射到热行或冷行，visit(i, visitor) 以声明顺序传入全部成员，
+     * 与 dm_visit_members 的调用方式一致。load/store/to_vector 与 T 互相转换。
+     * dm::pack 直接按 std::vector<T> 的格式读写: 逐行经 visit 写出各成员，不先还原出 T，
+     * 两者的编码互通。
+     */
+    template <typename T, std::size_t... Hot>
+    class split {
+        static constexpr std::size_t member_count = dm_member_count_v<T>;
+        using layout = detail::split_layout<member_count, Hot...>;
+        static_assert(sizeof...(Hot) > 0, "dm::split needs at least one hot member");
+        static_assert(layout::valid(), "hot member indices must be distinct and less than the member count");
+
+    public:
+        using value_type = T;
+        using hot_row = std::tuple<detail::split_member_t<T, Hot>...>;
+        using cold_row = typename detail::split_cold_row<T, layout, std::make_index_sequence<layout::cold_count>>::type;
+
+        template <std::size_t I>
+        static constexpr bool is_hot_v = layout::hot_mask[I];
+
+        template <bool Const>
+        class basic_reference {
+            using owner = std::conditional_t<Const, const split, split>;
+
+        public:
+            basic_reference(owner& s, std::size_t index) : s_(&s), index_(index) {}
+
+            template <std::size_t I>
+            auto& get() const { return s_->template get<I>(index_); }
+
+            operator T() const { return s_->load(index_); }
+
+            template <bool C = Const, typename = std::enable_if_t<!C>>
+            const basic_reference& operator=(const T& value) const {
+                s_->store(index_, value);
+                return *this;
+            }
+
+        private:
+            owner* s_;
+            std::size_t index_;
+        };
+
+        using reference = basic_reference<false>;
+        using const_reference = basic_reference<true>;
+
+        template <bool Const>
+        class basic_iterator {
+            using owner = std::conditional_t<Const, const split, split>;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = basic_reference<Const>;
+            using pointer = void;
+
+            basic_iterator(owner& s, std::size_t index) : s_(&s), index_(index) {}
+
+            reference operator*() const { return reference(*s_, index_); }
+            reference operator[](difference_type n) const { return reference(*s_, index_ + n); }
+            basic_iterator& operator++() { ++index_; return *this; }
+            basic_iterator operator++(int) { basic_iterator it = *this; ++index_; return it; }
+            basic_iterator& operator--() { --index_; return *this; }
+            basic_iterator operator--(int) { basic_iterator it = *this; --index_; return it; }
+            basic_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+            basic_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+            basic_iterator operator+(difference_type n) const { return basic_iterator(*s_, index_ + n); }
+            basic_iterator operator-(difference_type n) const { return basic_iterator(*s_, index_ - n); }
+            difference_type operator-(const basic_iterator& other) const {
+                return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+            }
+            bool operator==(const basic_iterator& other) const { return index_ == other.index_; }
+            bool operator!=(const basic_iterator& other) const { return index_ != other.index_; }
+            bool operator<(const basic_iterator& other) const { return index_ < other.index_; }
+
+        private:
+            owner* s_;
+            std::size_t index_;
+        };
+
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        split() = default;
+
+        explicit split(const std::vector<T>& values) {
+            reserve(values.size());
+            for (const T& value : values) { push_back(value); }
+        }
+
+        std::size_t size() const { return hot_.size(); }
+        bool empty() const { return hot_.empty(); }
+
+        void reserve(std::size_t capacity) {
+            hot_.reserve(capacity);
+            cold_.reserve(capacity);
+        }
+
+        void clear() {
+            hot_.clear();
+            cold_.clear();
+        }
+
+        void push_back(const T& value) {
+            auto members = dm_struct_to_tuple(value);
+            hot_.emplace_back(std::get<Hot>(members)...);
+            push_cold(make_cold(members, std::make_index_sequence<layout::cold_count>()));
+        }
+
+        void push_back(T&& value) {
+            auto members = dm_struct_to_tuple(value);
+            hot_.emplace_back(std::move(std::get<Hot>(members))...);
+            push_cold(make_cold_moved(members, std::make_index_sequence<layout::cold_count>()));
+        }
+
+        void pop_back() {
+            hot_.pop_back();
+            cold_.pop_back();
+        }
+
+        void erase(std::size_t index) {
+            hot_.erase(hot_.begin() + static_cast<std::ptrdiff_t>(index));
+            cold_.erase(cold_.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+
+        iterator begin() { return iterator(*this, 0); }
+        iterator end() { return iterator(*this, size()); }
+        const_iterator begin() const { return const_iterator(*this, 0); }
+        const_iterator end() const { return const_iterator(*this, size()); }
+
+        reference operator[](std::size_t index) { return reference(*this, index); }
+        const_reference operator[](std::size_t index) const { return const_reference(*this, index); }
+
+        /**
+         * @brief 第 index 个元素的第 I 个成员 (按 T 的声明顺序编号)。
+         */
+        template <std::size_t I>
+        auto& get(std::size_t index) {
+            if constexpr (is_hot_v<I>) { return std::get<layout::slots[I]>(hot_[index]); }
+            else { return std::get<layout::slots[I]>(cold_[index]); }
+        }
+
+        template <std::size_t I>
+        const auto& get(std::size_t index) const {
+            if constexpr (is_hot_v<I>) { return std::get<layout::slots[I]>(hot_[index]); }
+            else { return std::get<layout::slots[I]>(cold_[index]); }
+        }
+
+        /**
+         * @brief 以声明顺序的全部成员调用 visitor(members...)。
+         */
+        template <typename Visitor>
+        decltype(auto) visit(std::size_t index, Visitor&& visitor) {
+            return visit_impl(*this, index, visitor, std::make_index_sequence<member_count>());
+        }
+
+        template <typename Visitor>
+        decltype(auto) visit(std::size_t index, Visitor&& visitor) const {
+            return visit_impl(*this, index, visitor, std::make_index_sequence<member_count>());
+        }
+
+        /**
+         * @brief 对每一行的热成员调用 f(hot members...)，只遍历热数组。
+         */
+        template <typename F>
+        void for_each_hot(F&& f) {
+            for (hot_row& row : hot_) { std::apply(f, row); }
+        }
+
+        template <typename F>
+        void for_each_hot(F&& f) const {
+            for (const hot_row& row : hot_) { std::apply(f, row); }
+        }
+
+        std::vector<hot_row>& hot_rows() { return hot_; }
+        const std::vector<hot_row>& hot_rows() const { return hot_; }
+        const std::vector<cold_row>& cold_rows() const { return cold_; }
+
+        T load(std::size_t index) const { return load_impl(index, std::make_index_sequence<member_count>()); }
+
+        void store(std::size_t index, const T& value) {
+            store_impl(index, dm_struct_to_tuple(value), std::make_index_sequence<member_count>());
+        }
+
+        std::vector<T> to_vector() const {
+            std::vector<T> values;
+            values.reserve(size());
+            for (std::size_t i = 0; i < size(); ++i) { values.push_back(load(i)); }
+            return values;
+        }
+
+    private:
+        // 冷行写入失败时撤销已写入的热行，两个数组的长度始终相同
+        template <typename MakeRow>
+        void push_cold(MakeRow&& make_row) {
+            try {
+                cold_.push_back(make_row());
+            }
+            catch (...) {
+                hot_.pop_back();
+                throw;
+            }
+        }
+
+        template <typename Tuple, std::size_t... K>
+        static auto make_cold(const Tuple& members, std::index_sequence<K...>) {
+            return [&members] { return cold_row(std::get<layout::cold_indices[K]>(members)...); };
+        }
+
+        template <typename Tuple, std::size_t... K>
+        static auto make_cold_moved(Tuple& members, std::index_sequence<K...>) {
+            return [&members] { return cold_row(std::move(std::get<layout::cold_indices[K]>(members))...); };
+        }
+
+        template <typename Self, typename Visitor, std::size_t... I>
+        static decltype(auto) visit_impl(Self& self, std::size_t index, Visitor& visitor, std::index_sequence<I...>) {
+            return visitor(self.template get<I>(index)...);
+        }
+
+        template <std::size_t... I>
+        T load_impl(std::size_t index, std::index_sequence<I...>) const {
+            return T{ get<I>(index)... };
+        }
+
+        template <typename Tuple, std::size_t... I>
+        void store_impl(std::size_t index, const Tuple& members, std::index_sequence<I...>) {
+            ((get<I>(index) = std::get<I>(members)), ...);
+        }
+
+        std::vector<hot_row> hot_;
+        std::vector<cold_row> cold_;
+    };
+
+} // namespace dm
+
+#endif // __DMTYPETRAITS_SPLIT_H_INCLUDE__
@@ -13,6 +13,8 @@
 #include <cassert>
 #include <system_error>
 
+#include "dmtypetraits_compare.h"
+
 struct MyStruct {
 // export_begin    
     int foo;
@@ -37,9 +39,7 @@ struct Metadata {
     uint64_t timestamp;
 // export_end
     // 为了断言验证，需要提供 operator==
-    bool operator==(const Metadata& other) const {
-        return author == other.author && timestamp == other.timestamp;
-    }
+    bool operator==(const Metadata& other) const { return dm::equal(*this, other); }
 };
 
 // 主数据结构，包含多种复杂类型
@@ -54,14 +54,7 @@ struct ComplexData {
 
 // export_end
     // 为了断言验证，需要提供 operator==
-    bool operator==(const ComplexData& other) const {
-        return id == other.id &&
-            status == other.status &&
-            metadata == other.metadata &&
-            properties == other.properties &&
-            sensor_readings == other.sensor_readings &&
-            metadatas == other.metadatas;
-    }
+    bool operator==(const ComplexData& other) const { return dm::equal(*this, other); }
 };
 
 
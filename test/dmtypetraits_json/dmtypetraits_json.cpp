@@ -66,9 +66,122 @@ TEST_F(ReflectionTest, ObjectAccessor) {
     ASSERT_FALSE(set_fail);
     ASSERT_EQ(data.status, Status::Warning); // 值应保持不变
 }
+TEST_F(ReflectionTest, LookupByName) {
+    static_assert(dm::refl::find_field_index<ComplexData>("id") == 0);
+    static_assert(dm::refl::find_field_index<ComplexData>("metadatas") == 5);
+    static_assert(dm::refl::find_field_index<ComplexData>("unknown") == dm::refl::get_field_count<ComplexData>());
+    static_assert(dm::refl::find_field_index<Metadata>("timestamp") == 1);
+
+    // 各字段的描述符类型不同，find_field 以 variant 返回
+    auto field = dm::refl::find_field<ComplexData>("sensor_readings");
+    ASSERT_TRUE(field.has_value());
+    ASSERT_EQ(field->index(), 4u);
+    std::visit([](const auto& f) { ASSERT_EQ(f.name(), "sensor_readings"); }, *field);
+    ASSERT_FALSE(dm::refl::find_field<ComplexData>("sensor").has_value());
+
+    size_t size = 0;
+    ASSERT_TRUE(dm::refl::visit_field(data, "properties", [&](const auto&, const auto& value) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::map<std::string, int>>) { size = value.size(); }
+    }));
+    ASSERT_EQ(size, 2u);
+    ASSERT_FALSE(dm::refl::visit_field(data, "", [](const auto&, const auto&) {}));
+
+    auto accessor = dm::refl::make_accessor(data);
+    ASSERT_EQ(accessor.get("id"), "101");
+    ASSERT_EQ(accessor.get("metadata"), "[complex_type]");
+    ASSERT_FALSE(accessor.get("ID").has_value());
+    ASSERT_TRUE(accessor.set("id", 7));
+    ASSERT_EQ(data.id, 7);
+}
 // ==========================================================================
 
 
+TEST_F(ReflectionTest, TypedAccessor) {
+    auto accessor = dm::refl::make_accessor(data);
+
+    int* id = accessor.get<int>("id");
+    ASSERT_NE(id, nullptr);
+    ASSERT_EQ(id, &data.id);
+    ASSERT_EQ(accessor.get<double>("id"), nullptr);       // 类型不符
+    ASSERT_EQ(accessor.get<int>("missing"), nullptr);
+    const Metadata* metadata = accessor.get<const Metadata>("metadata");
+    ASSERT_NE(metadata, nullptr);
+    ASSERT_EQ(metadata->author, "tom");
+
+    size_t readings = 0;
+    ASSERT_TRUE(accessor.visit("sensor_readings", [&](auto& value) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::vector<float>>) { readings = value.size(); }
+    }));
+    ASSERT_EQ(readings, 3u);
+    ASSERT_FALSE(accessor.visit("missing", [](auto&) {}));
+
+    char buffer[32];
+    auto end = accessor.format_to("id", buffer);
+    ASSERT_TRUE(end.has_value());
+    ASSERT_EQ(std::string_view(buffer, static_cast<size_t>(*end - buffer)), "101");
+    end = accessor.format_to("status", buffer);
+    ASSERT_EQ(std::string_view(buffer, static_cast<size_t>(*end - buffer)), "0");
+    ASSERT_FALSE(accessor.format_to("missing", buffer).has_value());
+
+    std::string text;
+    accessor.format_to("properties", std::back_inserter(text));
+    ASSERT_EQ(text, "[complex_type]");
+    ASSERT_EQ(dm::refl::make_accessor(data.metadata).get("author"), "tom");
+}
+
+struct PlainRecord {
+    int16_t level;
+    std::string title;
+    std::vector<uint32_t> ids;
+};
+
+TEST_F(ReflectionTest, RuntimeTypeInfo) {
+    const dm::refl::runtime_type_info& info = dm::refl::get_runtime_type_info<ComplexData>();
+    ASSERT_EQ(&info, &dm::refl::get_runtime_type_info<ComplexData>());
+    ASSERT_EQ(info.name, "ComplexData");
+    ASSERT_EQ(info.size, sizeof(ComplexData));
+    ASSERT_EQ(info.field_count, 6u);
+    ASSERT_EQ(info[0].name, "id");
+    ASSERT_EQ(info[3].address(&data), &data.properties);
+    ASSERT_EQ(info[1].kind, dm::refl::field_kind::enumeration);
+    ASSERT_EQ(info[2].kind, dm::refl::field_kind::object);
+    ASSERT_EQ(info[3].kind, dm::refl::field_kind::map);
+    ASSERT_EQ(info[4].kind, dm::refl::field_kind::sequence);
+
+    const dm::refl::field_info* author = dm::refl::get_runtime_type_info<Metadata>().find("author");
+    ASSERT_NE(author, nullptr);
+    ASSERT_EQ(author->kind, dm::refl::field_kind::string);
+    ASSERT_EQ(*static_cast<const std::string*>(author->address(&data.metadata)), "tom");
+    ASSERT_EQ(info.find("missing"), nullptr);
+
+    // 按 void* 读写与序列化
+    const dm::refl::field_info* readings = info.find("sensor_readings");
+    ASSERT_NE(readings, nullptr);
+    std::vector<float> values;
+    readings->get(&data, &values);
+    ASSERT_EQ(values.size(), 3u);
+    values.push_back(0.4f);
+    readings->set(&data, &values);
+    ASSERT_EQ(data.sensor_readings.size(), 4u);
+
+    std::vector<char> buffer;
+    readings->serialize(&data, buffer);
+    ComplexData copy{};
+    ASSERT_EQ(readings->deserialize(&copy, buffer.data(), buffer.size()), std::errc{});
+    ASSERT_EQ(copy.sensor_readings, data.sensor_readings);
+
+    // 没有 traits 的聚合体按成员位置生成
+    PlainRecord record{ 3, "plain", { 7 } };
+    const dm::refl::runtime_type_info& plain = dm::refl::get_runtime_type_info<PlainRecord>();
+    ASSERT_EQ(plain.field_count, 3u);
+    ASSERT_EQ(plain[0].kind, dm::refl::field_kind::signed_integer);
+    ASSERT_EQ(plain[1].offset, static_cast<size_t>(reinterpret_cast<char*>(&record.title) - reinterpret_cast<char*>(&record)));
+    ASSERT_EQ(plain[2].size, sizeof(std::vector<uint32_t>));
+    int16_t level = 0;
+    plain[0].get(&record, &level);
+    ASSERT_EQ(level, 3);
+}
+
 TEST_F(ReflectionTest, NestedReflection) {
     bool metadata_found_and_tested = false;
     dm::refl::visit_fields(data, [&](const auto& field, const auto& value) {
@@ -0,0 +1,1310 @@
+#include "gtest.h"
+#include "dmtypetraits.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <variant>
+#include <bitset>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+// --- 测试用的辅助类型 ---
+struct TimeSeries {
+    std::string name;
+    dm::pack::delta_vector<uint64_t> timestamps;
+    dm::pack::delta_vector<int32_t> values;
+
+    bool operator==(const TimeSeries& other) const {
+        return name == other.name && timestamps == other.timestamps && values == other.values;
+    }
+};
+
+struct VisibilityFrame {
+    uint32_t frame_id;
+    std::vector<bool> visible;
+    std::bitset<100> layers;
+
+    bool operator==(const VisibilityFrame& other) const {
+        return frame_id == other.frame_id && visible == other.visible && layers == other.layers;
+    }
+};
+
+struct Point {
+    int32_t x;
+    int16_t y;
+
+    bool operator==(const Point& other) const { return x == other.x && y == other.y; }
+    bool operator<(const Point& other) const { return x < other.x || (x == other.x && y < other.y); }
+};
+
+struct Document {
+    std::string title;
+    std::u16string subtitle;
+    std::vector<std::string> tags;
+    std::vector<Point> points;
+    std::map<std::string, std::vector<std::string>> index;
+    std::set<Point> anchors;
+    std::optional<std::string> note;
+
+    bool operator==(const Document& other) const {
+        return title == other.title && subtitle == other.subtitle && tags == other.tags && points == other.points &&
+            index == other.index && anchors == other.anchors && note == other.note;
+    }
+};
+
+enum class Level : uint8_t { low, mid, high };
+
+template <>
+struct dm::pack::enum_range<Level> {
+    static constexpr Level min = Level::low;
+    static constexpr Level max = Level::high;
+};
+
+struct Request {
+    uint32_t id;
+    bool urgent;
+    Level level;
+    std::vector<Level> history;
+    std::variant<int32_t, std::string> payload;
+    std::vector<std::string> args;
+};
+
+struct Metadata {
+    std::string author;
+    uint64_t timestamp;
+};
+
+struct Vec3 {
+    float x, y, z;
+};
+
+struct Message {
+    int32_t id;
+    std::map<std::string, int32_t> headers;
+    Metadata metadata;
+    std::vector<Metadata> metadatas;
+    std::array<Vec3, 4> corners;
+    std::vector<Vec3> path;
+    std::tuple<std::string, std::vector<int32_t>> extra;
+};
+
+// 同一结构的两个版本，用于迁移解码
+struct SampleV1 {
+    int16_t x;
+    int16_t y;
+};
+
+struct SampleV2 {
+    int32_t x;
+    int32_t y;
+    int32_t z = -1;
+};
+
+struct RecordV1 {
+    int32_t id;
+    float value;
+    std::string name;
+    std::vector<SampleV1> samples;
+    std::optional<uint8_t> level;
+};
+
+struct RecordV2 {
+    int64_t id;
+    double value;
+    std::string label;
+    std::vector<SampleV2> samples;
+    std::optional<uint32_t> level;
+    int32_t version = 7;
+};
+
+struct RecordV3 {
+    std::string label;
+    int64_t id;
+};
+
+struct HeaderV1 {
+    uint8_t kind;
+    uint32_t length;
+    uint16_t crc;
+};
+
+struct HeaderV2 {
+    uint16_t crc;
+    int64_t length;
+    std::string note;
+};
+
+// 同样的成员，一个走表驱动编解码，一个走默认的内联展开
+struct CompactInner {
+    using codec_t = dm::pack::compact_codec;
+    std::string name;
+    int32_t a;
+    int32_t b;
+};
+
+struct CompactMessage {
+    using codec_t = dm::pack::compact_codec;
+    uint8_t kind;
+    uint32_t id;
+    uint64_t stamp;
+    Vec3 origin;
+    CompactInner inner;
+    std::vector<CompactInner> items;
+    std::optional<std::string> note;
+    double score;
+};
+
+struct PlainInner {
+    std::string name;
+    int32_t a;
+    int32_t b;
+};
+
+struct PlainMessage {
+    uint8_t kind;
+    uint32_t id;
+    uint64_t stamp;
+    Vec3 origin;
+    PlainInner inner;
+    std::vector<PlainInner> items;
+    std::optional<std::string> note;
+    double score;
+};
+
+// 多个实例共享同一份网格
+struct Mesh {
+    std::string name;
+    std::vector<float> vertices;
+};
+
+struct Instance {
+    std::shared_ptr<Mesh> mesh;
+    Vec3 position;
+};
+
+struct Scene {
+    std::vector<std::shared_ptr<Mesh>> meshes;
+    std::vector<Instance> instances;
+    std::unique_ptr<Mesh> preview;
+    std::shared_ptr<const std::string> title;
+};
+
+// 递归类型: 子节点指针指回外层结构体
+struct TreeNode {
+    int32_t value;
+    std::vector<std::shared_ptr<TreeNode>> children;
+    std::unique_ptr<TreeNode> next;
+};
+
+struct TreeNodeV2 {
+    int32_t value;
+    std::vector<std::shared_ptr<TreeNodeV2>> children;
+    std::unique_ptr<TreeNodeV2> next;
+    std::string label;
+};
+
+// 所有容器都声明了上限，编码长度在编译期可知
+struct BoundedOrder {
+    uint32_t id;
+    dm::pack::bounded<std::string, 16> symbol;
+    dm::pack::bounded<std::vector<Vec3>, 4> legs;
+    std::optional<int64_t> limit;
+    std::variant<int32_t, double> price;
+};
+
+struct UnboundedOrder {
+    uint32_t id;
+    std::string symbol;
+    std::vector<Vec3> legs;
+    std::optional<int64_t> limit;
+    std::variant<int32_t, double> price;
+};
+
+// 同样的成员，一个去除填充 (线上 10 字节)，一个整块存放 (24 字节)
+struct PackedSample {
+    using codec_t = dm::pack::packed_codec;
+    uint8_t a;
+    uint64_t b;
+    uint8_t c;
+};
+
+struct PaddedSample {
+    uint8_t a;
+    uint64_t b;
+    uint8_t c;
+};
+
+// 没有填充，声明与否都整块存放
+struct DensePacked {
+    using codec_t = dm::pack::packed_codec;
+    uint32_t id;
+    float value;
+};
+
+// 平凡可拷贝但含有去除填充的成员，同样逐成员写出
+struct PackedHolder {
+    uint16_t tag;
+    PackedSample samples[2];
+};
+
+struct PackedRecord {
+    std::string name;
+    std::vector<PackedSample> samples;
+    std::optional<PackedHolder> holder;
+};
+
+// --- Test Suite for delta_vector ---
+TEST(DmPackDeltaTest, RoundTripMonotonic) {
+    TimeSeries ts;
+    ts.name = "cpu";
+    for (uint64_t i = 0; i < 10000; ++i) {
+        ts.timestamps.push_back(1700000000000ull + i * 1000 + (i % 7));
+        ts.values.push_back(static_cast<int32_t>((i % 200) - 100));
+    }
+
+    auto buffer = dm::pack::serialize(ts);
+    EXPECT_EQ(buffer.size(), dm::pack::get_needed_size(ts));
+
+    // 原始编码至少需要 12 字节/元素，压缩后应显著更小
+    EXPECT_LT(buffer.size(), ts.timestamps.size() * 4);
+
+    auto [err, result] = dm::pack::deserialize<TimeSeries>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(result, ts);
+}
+
+TEST(DmPackDeltaTest, ExtremeValues) {
+    dm::pack::delta_vector<int64_t> v{ INT64_MIN, INT64_MAX, 0, -1, INT64_MAX, INT64_MIN, 42 };
+    auto buffer = dm::pack::serialize(v);
+    auto [err, result] = dm::pack::deserialize<dm::pack::delta_vector<int64_t>>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(result, v);
+
+    dm::pack::delta_vector<uint8_t> empty;
+    auto empty_buffer = dm::pack::serialize(empty);
+    auto [err2, empty_result] = dm::pack::deserialize<dm::pack::delta_vector<uint8_t>>(empty_buffer);
+    ASSERT_EQ(err2, std::errc{});
+    EXPECT_TRUE(empty_result.empty());
+}
+
+TEST(DmPackDeltaTest, EveryBlockWidth) {
+    // 每个位宽都覆盖定长读取与块尾剥离两段，含 58..64 位跨 9 个字节的情况
+    for (unsigned width = 0; width <= 64; ++width) {
+        for (size_t n : { 2, 9, 130, 300 }) {
+            dm::pack::delta_vector<uint64_t> v;
+            uint64_t value = 12345;
+            uint64_t seed = 0x9e3779b97f4a7c15ull * (width + 1);
+            for (size_t i = 0; i < n; ++i) {
+                v.push_back(value);
+                seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+                value += width == 0 ? 0 : (width == 64 ? seed : seed >> (64 - width));
+            }
+            auto buffer = dm::pack::serialize(v);
+            auto [err, result] = dm::pack::deserialize<dm::pack::delta_vector<uint64_t>>(buffer);
+            ASSERT_EQ(err, std::errc{}) << width << " " << n;
+            ASSERT_EQ(result, v) << width << " " << n;
+        }
+    }
+}
+
+TEST(DmPackDeltaTest, TruncatedBuffer) {
+    dm::pack::delta_vector<uint32_t> v;
+    for (uint32_t i = 0; i < 1000; ++i) { v.push_back(i * i); }
+    auto buffer = dm::pack::serialize(v);
+    buffer.resize(buffer.size() - 3);
+    auto [err, result] = dm::pack::deserialize<dm::pack::delta_vector<uint32_t>>(buffer);
+    EXPECT_EQ(err, std::errc::no_buffer_space);
+}
+
+// --- Test Suite for xor_vector ---
+TEST(DmPackXorTest, RoundTripBitExact) {
+    dm::pack::xor_vector<double> v{ 1.0, 1.0, -0.0, 0.0,
+                                    std::numeric_limits<double>::infinity(),
+                                    -std::numeric_limits<double>::infinity(),
+                                    std::numeric_limits<double>::quiet_NaN(),
+                                    std::numeric_limits<double>::denorm_min(),
+                                    std::numeric_limits<double>::max(), 3.14159 };
+    auto buffer = dm::pack::serialize(v);
+    EXPECT_EQ(buffer.size(), dm::pack::get_needed_size(v));
+
+    auto [err, result] = dm::pack::deserialize<dm::pack::xor_vector<double>>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    ASSERT_EQ(result.size(), v.size());
+    EXPECT_EQ(std::memcmp(result.data(), v.data(), v.size() * sizeof(double)), 0);
+
+    dm::pack::xor_vector<float> f{ 0.5f, -0.0f, std::numeric_limits<float>::quiet_NaN(), 0.5f, 0.75f };
+    auto fbuffer = dm::pack::serialize(f);
+    auto [ferr, fresult] = dm::pack::deserialize<dm::pack::xor_vector<float>>(fbuffer);
+    ASSERT_EQ(ferr, std::errc{});
+    ASSERT_EQ(fresult.size(), f.size());
+    EXPECT_EQ(std::memcmp(fresult.data(), f.data(), f.size() * sizeof(float)), 0);
+}
+
+TEST(DmPackXorTest, SlowlyChangingSeries) {
+    dm::pack::xor_vector<double> v;
+    for (int i = 0; i < 4096; ++i) {
+        v.push_back(20.0 + (i / 64) * 0.5);
+    }
+    auto buffer = dm::pack::serialize(v);
+    // 原始编码需要 8 字节/元素，重复值只占 1 位
+    EXPECT_LT(buffer.size(), v.size());
+
+    auto [err, result] = dm::pack::deserialize<dm::pack::xor_vector<double>>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(static_cast<std::vector<double>&>(result), static_cast<std::vector<double>&>(v));
+}
+
+TEST(DmPackXorTest, TruncatedBuffer) {
+    dm::pack::xor_vector<float> v;
+    for (int i = 0; i < 1000; ++i) { v.push_back(i * 0.37f); }
+    auto buffer = dm::pack::serialize(v);
+    buffer.resize(buffer.size() - 3);
+    auto [err, result] = dm::pack::deserialize<dm::pack::xor_vector<float>>(buffer);
+    EXPECT_EQ(err, std::errc::no_buffer_space);
+}
+
+// --- Test Suite for std::vector<bool> / std::bitset ---
+TEST(DmPackBitsTest, RoundTripPacked) {
+    VisibilityFrame frame;
+    frame.frame_id = 7;
+    for (size_t i = 0; i < 1000; ++i) { frame.visible.push_back(i % 3 == 0 || i % 64 == 63); }
+    frame.layers.set(0).set(63).set(64).set(99);
+
+    auto buffer = dm::pack::serialize(frame);
+    EXPECT_EQ(buffer.size(), dm::pack::get_needed_size(frame));
+    // 每个 bool 只占 1 位
+    EXPECT_EQ(buffer.size(), sizeof(uint32_t) * 3 + (1000 + 7) / 8 + (100 + 7) / 8);
+
+    auto [err, result] = dm::pack::deserialize<VisibilityFrame>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(result, frame);
+}
+
+TEST(DmPackBitsTest, TailAndEmpty) {
+    for (size_t n : { 0, 1, 7, 8, 63, 64, 65, 129 }) {
+        std::vector<bool> v(n, true);
+        auto buffer = dm::pack::serialize(v);
+        auto [err, result] = dm::pack::deserialize<std::vector<bool>>(buffer);
+        ASSERT_EQ(err, std::errc{});
+        EXPECT_EQ(result, v);
+    }
+}
+
+// 整字读写与逐位读写的结果必须逐字节相同
+template <typename Bits>
+std::vector<char> encode_bits_each(const Bits& bits) {
+    std::vector<char> out(dm::pack::detail::bits_encoded_size(bits.size()));
+    dm::pack::detail::bits_encode_each(bits, bits.size(), out.data());
+    return out;
+}
+
+template <std::size_t N>
+void check_bitset_words() {
+    std::bitset<N> b;
+    for (size_t i = 0; i < N; i += 3) { b.set(i); }
+    if (N > 0) { b.set(N - 1); }
+    std::vector<char> out(dm::pack::detail::bits_encoded_size(N));
+    dm::pack::detail::bits_encode(b, N, out.data());
+    EXPECT_EQ(out, encode_bits_each(b)) << N;
+    std::bitset<N> back;
+    dm::pack::detail::bits_decode(out.data(), N, back);
+    EXPECT_EQ(back, b) << N;
+}
+
+TEST(DmPackBitsTest, WordsMatchBits) {
+    check_bitset_words<1>();
+    check_bitset_words<13>();
+    check_bitset_words<64>();
+    check_bitset_words<65>();
+    check_bitset_words<200>();
+    check_bitset_words<1024>();
+    check_bitset_words<1500>();
+    check_bitset_words<1000003>();
+
+    // pop_back 之后超出 size() 的位仍留在底层存储中，不能写进输出
+    for (size_t n : { 1, 9, 64, 100 }) {
+        std::vector<bool> v(n + 5, true);
+        for (size_t i = 0; i < n; i += 2) { v[i] = false; }
+        v.resize(n);
+        std::vector<char> out(dm::pack::detail::bits_encoded_size(n));
+        dm::pack::detail::bits_encode(v, n, out.data());
+        EXPECT_EQ(out, encode_bits_each(v)) << n;
+        std::vector<bool> back(n, false);
+        dm::pack::detail::bits_decode(out.data(), n, back);
+        EXPECT_EQ(back, v) << n;
+    }
+}
+
+TEST(DmPackBitsTest, TruncatedBuffer) {
+    std::vector<bool> v(200, true);
+    auto buffer = dm::pack::serialize(v);
+    buffer.resize(buffer.size() - 1);
+    auto [err, result] = dm::pack::deserialize<std::vector<bool>>(buffer);
+    EXPECT_EQ(err, std::errc::no_buffer_space);
+}
+
+// --- Test Suite for in-place decoding ---
+TEST(DmPackDecodeTest, RoundTripNested) {
+    Document doc;
+    doc.title = std::string(300, 'x');
+    doc.subtitle = u"subtitle";
+    doc.tags = { "alpha", std::string(100, 'b'), "" };
+    doc.points = { { 1, 2 }, { -3, 4 }, { INT32_MAX, INT16_MIN } };
+    doc.index = { { "k1", { "a", "b" } }, { "k2", {} }, { std::string(64, 'k'), { std::string(64, 'v') } } };
+    doc.anchors = { { 5, 5 }, { 1, 9 } };
+    doc.note = "note";
+
+    auto buffer = dm::pack::serialize(doc);
+    auto [err, result] = dm::pack::deserialize<Document>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(result, doc);
+}
+
+TEST(DmPackDecodeTest, ReuseTarget) {
+    Document big;
+    big.tags = { "1", "2", "3", "4" };
+    big.points = { { 1, 1 }, { 2, 2 } };
+    big.index = { { "stale", { "x" } } };
+    big.anchors = { { 7, 7 } };
+    big.note = std::string(100, 'n');
+
+    Document small;
+    small.tags = { std::string(50, 'z') };
+    small.note = "short";
+
+    // 解码到已有内容的对象上，结果必须与新建对象解码一致
+    Document target = big;
+    auto buffer = dm::pack::serialize(small);
+    ASSERT_EQ(dm::pack::deserialize_to(target, buffer), std::errc{});
+    EXPECT_EQ(target, small);
+
+    buffer = dm::pack::serialize(big);
+    ASSERT_EQ(dm::pack::deserialize_to(target, buffer), std::errc{});
+    EXPECT_EQ(target, big);
+}
+
+// --- Test Suite for validate / memory budget ---
+static Request make_request() {
+    Request req;
+    req.id = 42;
+    req.urgent = true;
+    req.level = Level::mid;
+    req.history = { Level::low, Level::high, Level::mid };
+    req.payload = std::string("payload");
+    req.args = { "a", "bb", std::string(40, 'c') };
+    return req;
+}
+
+TEST(DmPackValidateTest, AcceptsValidInput) {
+    auto buffer = dm::pack::serialize(make_request());
+    EXPECT_EQ(dm::pack::validate<Request>(buffer), std::errc{});
+    EXPECT_EQ(dm::pack::validate<Request>(buffer.data(), buffer.size()), std::errc{});
+}
+
+TEST(DmPackValidateTest, RejectsEveryTruncation) {
+    auto buffer = dm::pack::serialize(make_request());
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        EXPECT_NE(dm::pack::validate<Request>(buffer.data(), len), std::errc{}) << len;
+        Request out;
+        EXPECT_NE(dm::pack::deserialize_to(out, buffer.data(), len), std::errc{}) << len;
+    }
+}
+
+TEST(DmPackValidateTest, RejectsBadValues) {
+    const auto buffer = dm::pack::serialize(make_request());
+    // 头部 4 字节类型码之后依次是 id(4)、urgent(1)、level(1)
+    auto bad_bool = buffer;
+    bad_bool[8] = 2;
+    EXPECT_EQ(dm::pack::validate<Request>(bad_bool), std::errc::invalid_argument);
+
+    auto bad_enum = buffer;
+    bad_enum[9] = 7;
+    EXPECT_EQ(dm::pack::validate<Request>(bad_enum), std::errc::invalid_argument);
+
+    // history 的第二个元素
+    auto bad_history = buffer;
+    bad_history[10 + sizeof(uint32_t) + 1] = 3;
+    EXPECT_EQ(dm::pack::validate<Request>(bad_history), std::errc::invalid_argument);
+
+    // variant 下标
+    auto bad_index = buffer;
+    bad_index[10 + sizeof(uint32_t) + 3] = 9;
+    EXPECT_EQ(dm::pack::validate<Request>(bad_index), std::errc::invalid_argument);
+    auto [err, result] = dm::pack::deserialize<Request>(bad_index);
+    EXPECT_EQ(err, std::errc::invalid_argument);
+}
+
+TEST(DmPackValidateTest, RejectsForgedCount) {
+    std::vector<std::string> v{ "x" };
+    auto buffer = dm::pack::serialize(v);
+    uint32_t forged = 0xFFFFFFF0u;
+    std::memcpy(buffer.data() + sizeof(uint32_t), &forged, sizeof(forged));
+    EXPECT_EQ(dm::pack::validate<std::vector<std::string>>(buffer), std::errc::no_buffer_space);
+    auto [err, result] = dm::pack::deserialize<std::vector<std::string>>(buffer);
+    EXPECT_EQ(err, std::errc::no_buffer_space);
+}
+
+TEST(DmPackValidateTest, MemoryBudget) {
+    std::vector<std::string> v(1000, std::string(100, 'x'));
+    auto buffer = dm::pack::serialize(v);
+
+    auto [err, result] = dm::pack::deserialize<std::vector<std::string>>(buffer, dm::pack::memory_budget{ 4096 });
+    EXPECT_EQ(err, std::errc::not_enough_memory);
+
+    auto [err2, result2] = dm::pack::deserialize<std::vector<std::string>>(buffer, dm::pack::memory_budget{ 1 << 20 });
+    ASSERT_EQ(err2, std::errc{});
+    EXPECT_EQ(result2, v);
+}
+
+// --- Test Suite for get_path ---
+static Message make_message() {
+    Message msg;
+    msg.id = 9;
+    msg.headers = { { "h1", 1 }, { "h2", 2 } };
+    msg.metadata = { "root", 1700000000 };
+    for (int i = 0; i < 5; ++i) { msg.metadatas.push_back({ "author" + std::to_string(i), uint64_t(100 + i) }); }
+    for (int i = 0; i < 4; ++i) { msg.corners[i] = { float(i), float(i * 2), float(i * 3) }; }
+    msg.path = { { 1, 2, 3 }, { 4, 5, 6 } };
+    msg.extra = { "tail", { 7, 8, 9 } };
+    return msg;
+}
+
+TEST(DmPackPathTest, NestedFields) {
+    auto buffer = dm::pack::serialize(make_message());
+
+    auto [e1, timestamp] = dm::pack::get_path<Message, 2, 1>(buffer);
+    ASSERT_EQ(e1, std::errc{});
+    EXPECT_EQ(timestamp, 1700000000u);
+
+    auto [e2, author] = dm::pack::get_path<Message, 3, 3, 0>(buffer);
+    ASSERT_EQ(e2, std::errc{});
+    EXPECT_EQ(author, "author3");
+
+    auto [e3, y] = dm::pack::get_path<Message, 4, 2, 1>(buffer.data(), buffer.size());
+    ASSERT_EQ(e3, std::errc{});
+    EXPECT_EQ(y, 4.0f);
+
+    auto [e4, z] = dm::pack::get_path<Message, 5, 1, 2>(buffer);
+    ASSERT_EQ(e4, std::errc{});
+    EXPECT_EQ(z, 6.0f);
+
+    auto [e5, last] = dm::pack::get_path<Message, 6, 1, 2>(buffer);
+    ASSERT_EQ(e5, std::errc{});
+    EXPECT_EQ(last, 9);
+
+    auto [e6, whole] = dm::pack::get_path<Message, 3>(buffer);
+    ASSERT_EQ(e6, std::errc{});
+    EXPECT_EQ(whole.size(), 5u);
+
+    auto [e7, id] = dm::pack::get_field<Message, 0>(buffer);
+    ASSERT_EQ(e7, std::errc{});
+    EXPECT_EQ(id, 9);
+
+    static_assert(std::is_same_v<dm::pack::detail::path_field_t<Message, 3, 0, 1>, uint64_t>);
+}
+
+TEST(DmPackPathTest, OutOfRangeAndTruncated) {
+    auto buffer = dm::pack::serialize(make_message());
+    auto [err, author] = dm::pack::get_path<Message, 3, 7, 0>(buffer);
+    EXPECT_EQ(err, std::errc::result_out_of_range);
+
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        auto [e, value] = dm::pack::get_path<Message, 6, 1, 2>(buffer.data(), len);
+        EXPECT_NE(e, std::errc{}) << len;
+    }
+}
+
+// --- Test Suite for migrator ---
+RecordV1 make_record_v1() {
+    return { 42, 1.5f, "sensor", { {1, -2}, {3, 4}, {-5, 6} }, 9 };
+}
+
+TEST(DmPackMigrateTest, WidenAndAppend) {
+    auto buffer = dm::pack::serialize(make_record_v1());
+    dm::pack::migrator<RecordV2> m(dm::pack::get_type_literal<RecordV1>());
+    ASSERT_EQ(m.error(), std::errc{});
+    EXPECT_FALSE(m.identical());
+
+    auto [err, r] = m.deserialize(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(r.id, 42);
+    EXPECT_EQ(r.value, 1.5);
+    EXPECT_EQ(r.label, "sensor");
+    ASSERT_EQ(r.samples.size(), 3u);
+    EXPECT_EQ(r.samples[0].y, -2);
+    EXPECT_EQ(r.samples[2].x, -5);
+    EXPECT_EQ(r.samples[2].z, -1);
+    EXPECT_EQ(r.level, 9u);
+    EXPECT_EQ(r.version, 7);
+
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        EXPECT_NE(m.deserialize(buffer.data(), len).errc, std::errc{}) << len;
+    }
+}
+
+TEST(DmPackMigrateTest, ReorderAndDrop) {
+    auto buffer = dm::pack::serialize(make_record_v1());
+    dm::pack::migrator<RecordV3> m(dm::pack::get_type_literal<RecordV1>(), { 2, 0 });
+    ASSERT_EQ(m.error(), std::errc{});
+    auto [err, r] = m.deserialize(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(r.label, "sensor");
+    EXPECT_EQ(r.id, 42);
+
+    // 平凡可拷贝的旧结构体整块存放，按推算出的成员偏移读取
+    auto header = dm::pack::serialize(HeaderV1{ 3, 70000, 0xBEEF });
+    dm::pack::migrator<HeaderV2> hm(dm::pack::get_type_literal<HeaderV1>(), { 2, 1, -1 });
+    ASSERT_EQ(hm.error(), std::errc{});
+    auto [herr, h] = hm.deserialize(header);
+    ASSERT_EQ(herr, std::errc{});
+    EXPECT_EQ(h.crc, 0xBEEF);
+    EXPECT_EQ(h.length, 70000);
+    EXPECT_TRUE(h.note.empty());
+}
+
+TEST(DmPackMigrateTest, IdenticalAndRejected) {
+    auto buffer = dm::pack::serialize(make_record_v1());
+    dm::pack::migrator<RecordV1> same(dm::pack::get_type_literal<RecordV1>());
+    ASSERT_EQ(same.error(), std::errc{});
+    EXPECT_TRUE(same.identical());
+    auto [err, r] = same.deserialize(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(r.samples[1].x, 3);
+
+    // 数据不是由该描述串对应的类型写出的
+    dm::pack::migrator<SampleV2> m(dm::pack::get_type_literal<SampleV1>());
+    ASSERT_EQ(m.error(), std::errc{});
+    EXPECT_EQ(m.deserialize(buffer).errc, std::errc::invalid_argument);
+    auto header = dm::pack::serialize(HeaderV1{ 1, 2, 3 });
+
+    // string 无法转换为整数；缩窄同样不允许
+    dm::pack::migrator<HeaderV2> bad(dm::pack::get_type_literal<RecordV3>());
+    EXPECT_EQ(bad.error(), std::errc::not_supported);
+    EXPECT_EQ(bad.deserialize(header).errc, std::errc::not_supported);
+    dm::pack::migrator<SampleV1> narrow(dm::pack::get_type_literal<SampleV2>());
+    EXPECT_EQ(narrow.error(), std::errc::not_supported);
+
+    dm::pack::migrator<RecordV2> garbage(std::string_view("\x80", 1));
+    EXPECT_EQ(garbage.error(), std::errc::invalid_argument);
+}
+
+// --- Test Suite for compact_codec ---
+TEST(DmPackCompactTest, SameWireFormat) {
+    CompactMessage c{ 3, 77, 1700000000123ull, { 1.f, 2.f, 3.f }, { "in", -1, 2 }, { { "x", 1, 2 }, { "yy", 3, 4 } }, "note", 0.25 };
+    PlainMessage p{ 3, 77, 1700000000123ull, { 1.f, 2.f, 3.f }, { "in", -1, 2 }, { { "x", 1, 2 }, { "yy", 3, 4 } }, "note", 0.25 };
+    static_assert(dm::pack::detail::dm_pack_use_compact_v<CompactMessage>);
+    static_assert(!dm::pack::detail::dm_pack_use_compact_v<PlainMessage>);
+
+    EXPECT_EQ(dm::pack::get_needed_size(c), dm::pack::get_needed_size(p));
+    auto buffer = dm::pack::serialize(c);
+    EXPECT_EQ(buffer, dm::pack::serialize(p));
+
+    auto [err, out] = dm::pack::deserialize<CompactMessage>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(out.id, 77u);
+    EXPECT_EQ(out.stamp, 1700000000123ull);
+    EXPECT_EQ(out.origin.z, 3.f);
+    EXPECT_EQ(out.inner.name, "in");
+    EXPECT_EQ(out.inner.a, -1);
+    ASSERT_EQ(out.items.size(), 2u);
+    EXPECT_EQ(out.items[1].name, "yy");
+    EXPECT_EQ(out.items[1].b, 4);
+    EXPECT_EQ(out.note, "note");
+    EXPECT_EQ(out.score, 0.25);
+    EXPECT_EQ(dm::pack::validate<CompactMessage>(buffer), std::errc{});
+}
+
+TEST(DmPackCompactTest, ByteTypesAndTruncation) {
+    CompactMessage c{ 1, 2, 3, { 4.f, 5.f, 6.f }, { "abc", 7, 8 }, { { "d", 9, 10 } }, std::nullopt, 1.5 };
+    auto buffer = dm::pack::serialize<std::vector<unsigned char>>(c);
+    auto [err, out] = dm::pack::deserialize<CompactMessage>(buffer.data(), buffer.size());
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(out.inner.name, "abc");
+    EXPECT_EQ(out.items[0].b, 10);
+    EXPECT_FALSE(out.note.has_value());
+
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        EXPECT_NE(dm::pack::deserialize<CompactMessage>(buffer.data(), len).errc, std::errc{}) << len;
+    }
+}
+
+// --- Test Suite for shared_ptr / unique_ptr ---
+TEST(DmPackSharedPtrTest, SharedIdentity) {
+    Scene scene;
+    auto rock = std::make_shared<Mesh>(Mesh{ "rock", std::vector<float>(300, 1.f) });
+    auto tree = std::make_shared<Mesh>(Mesh{ "tree", std::vector<float>(600, 2.f) });
+    scene.meshes = { rock, tree };
+    for (int i = 0; i < 8; ++i) { scene.instances.push_back({ i % 2 ? tree : rock, { float(i), 0.f, 0.f } }); }
+    scene.instances.push_back({ nullptr, { 9.f, 9.f, 9.f } });
+    scene.preview = std::make_unique<Mesh>(Mesh{ "preview", { 0.5f } });
+    scene.title = std::make_shared<const std::string>("forest");
+
+    auto buffer = dm::pack::serialize(scene);
+    EXPECT_EQ(buffer.size(), dm::pack::get_needed_size(scene));
+    // 网格只写出一次，每个实例只多一个 4 字节的回引
+    EXPECT_LT(buffer.size(), sizeof(float) * (300 + 600) + 1024);
+
+    auto [err, out] = dm::pack::deserialize<Scene>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    ASSERT_EQ(out.meshes.size(), 2u);
+    EXPECT_EQ(out.meshes[0]->name, "rock");
+    EXPECT_EQ(out.meshes[1]->vertices.size(), 600u);
+    ASSERT_EQ(out.instances.size(), 9u);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(out.instances[i].mesh, out.meshes[i % 2]) << i;
+        EXPECT_EQ(out.instances[i].position.x, float(i));
+    }
+    EXPECT_EQ(out.instances[8].mesh, nullptr);
+    EXPECT_EQ(out.meshes[0].use_count(), 5);
+    ASSERT_NE(out.preview, nullptr);
+    EXPECT_EQ(out.preview->name, "preview");
+    ASSERT_NE(out.title, nullptr);
+    EXPECT_EQ(*out.title, "forest");
+    EXPECT_EQ(dm::pack::validate<Scene>(buffer), std::errc{});
+
+    // 再次序列化得到相同的字节
+    EXPECT_EQ(dm::pack::serialize(out), buffer);
+}
+
+TEST(DmPackSharedPtrTest, NullAndUnique) {
+    Scene scene;
+    auto buffer = dm::pack::serialize(scene);
+    Scene out;
+    out.preview = std::make_unique<Mesh>();
+    out.title = std::make_shared<const std::string>("stale");
+    ASSERT_EQ(dm::pack::deserialize_to(out, buffer), std::errc{});
+    EXPECT_EQ(out.preview, nullptr);
+    EXPECT_EQ(out.title, nullptr);
+
+    std::unique_ptr<int32_t> value = std::make_unique<int32_t>(42);
+    auto [err, v] = dm::pack::deserialize<std::unique_ptr<int32_t>>(dm::pack::serialize(value));
+    ASSERT_EQ(err, std::errc{});
+    ASSERT_NE(v, nullptr);
+    EXPECT_EQ(*v, 42);
+}
+
+TEST(DmPackSharedPtrTest, RejectsForgedReference) {
+    auto mesh = std::make_shared<Mesh>(Mesh{ "m", { 1.f } });
+    std::vector<std::shared_ptr<Mesh>> meshes{ mesh, mesh };
+    auto buffer = dm::pack::serialize(meshes);
+    ASSERT_EQ(dm::pack::validate<std::vector<std::shared_ptr<Mesh>>>(buffer), std::errc{});
+
+    // 第二个元素的回引改为指向尚未出现的对象
+    uint32_t tag = 0;
+    std::size_t last = buffer.size() - sizeof(uint32_t);
+    std::memcpy(&tag, buffer.data() + last, sizeof(tag));
+    EXPECT_EQ(tag, 2u);
+    tag = 3;
+    std::memcpy(buffer.data() + last, &tag, sizeof(tag));
+    EXPECT_EQ(dm::pack::validate<std::vector<std::shared_ptr<Mesh>>>(buffer), std::errc::invalid_argument);
+    EXPECT_EQ(dm::pack::deserialize<std::vector<std::shared_ptr<Mesh>>>(buffer).errc, std::errc::invalid_argument);
+
+    // 回引不能把对象当成另一种类型
+    std::tuple<std::shared_ptr<std::string>, std::shared_ptr<std::vector<float>>> pair{ std::make_shared<std::string>("s"), nullptr };
+    auto mixed = dm::pack::serialize(pair);
+    tag = 2;
+    std::memcpy(mixed.data() + mixed.size() - sizeof(uint32_t), &tag, sizeof(tag));
+    EXPECT_EQ(dm::pack::deserialize<decltype(pair)>(mixed).errc, std::errc::invalid_argument);
+
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        EXPECT_NE(dm::pack::deserialize<std::vector<std::shared_ptr<Mesh>>>(buffer.data(), len).errc, std::errc{}) << len;
+    }
+}
+
+TEST(DmPackSharedPtrTest, RecursiveTree) {
+    // 同一棵子树同时挂在根节点和左子节点下
+    auto shared = std::make_shared<TreeNode>();
+    shared->value = 3;
+    shared->children.push_back(std::make_shared<TreeNode>());
+    shared->children[0]->value = 4;
+    auto left = std::make_shared<TreeNode>();
+    left->value = 2;
+    left->children = { shared };
+    TreeNode root;
+    root.value = 1;
+    root.children = { left, shared, nullptr };
+    root.next = std::make_unique<TreeNode>();
+    root.next->value = 5;
+
+    auto buffer = dm::pack::serialize(root);
+    EXPECT_EQ(buffer.size(), dm::pack::get_needed_size(root));
+    EXPECT_EQ(dm::pack::validate<TreeNode>(buffer), std::errc{});
+    auto [err, out] = dm::pack::deserialize<TreeNode>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(out.value, 1);
+    ASSERT_EQ(out.children.size(), 3u);
+    ASSERT_NE(out.children[0], nullptr);
+    ASSERT_EQ(out.children[0]->children.size(), 1u);
+    EXPECT_EQ(out.children[0]->children[0], out.children[1]);
+    EXPECT_EQ(out.children[1]->value, 3);
+    EXPECT_EQ(out.children[1]->children[0]->value, 4);
+    EXPECT_EQ(out.children[2], nullptr);
+    ASSERT_NE(out.next, nullptr);
+    EXPECT_EQ(out.next->value, 5);
+    EXPECT_EQ(dm::pack::serialize(out), buffer);
+
+    // 描述串是有限的，类型不变时可以按描述串解码; 递归类型的结构变化不支持迁移
+    dm::pack::migrator<TreeNode> same(dm::pack::get_type_literal<TreeNode>());
+    ASSERT_EQ(same.error(), std::errc{});
+    EXPECT_TRUE(same.identical());
+    auto [err2, again] = same.deserialize(buffer);
+    ASSERT_EQ(err2, std::errc{});
+    EXPECT_EQ(again.children[0]->children[0], again.children[1]);
+    dm::pack::migrator<TreeNodeV2> changed(dm::pack::get_type_literal<TreeNode>());
+    EXPECT_EQ(changed.error(), std::errc::not_supported);
+
+    // 嵌套层数来自输入，超过 DMPACK_MAX_DEPTH 时报错而不是耗尽栈
+    TreeNode chain;
+    TreeNode* tail = &chain;
+    for (int i = 0; i <= DMPACK_MAX_DEPTH; ++i) {
+        tail->next = std::make_unique<TreeNode>();
+        tail = tail->next.get();
+    }
+    EXPECT_EQ(dm::pack::deserialize<TreeNode>(dm::pack::serialize(chain)).errc, std::errc::invalid_argument);
+}
+
+// --- Test Suite for bounded / max_size_v ---
+TEST(DmPackBoundedTest, MaxSizeAndStackBuffer) {
+    static_assert(dm::pack::is_bounded_v<BoundedOrder>);
+    static_assert(!dm::pack::is_bounded_v<UnboundedOrder>);
+    static_assert(dm::pack::max_size_v<Vec3> == sizeof(uint32_t) + sizeof(Vec3));
+    // 类型头 + id + (长度 + 16 字节) + (长度 + 4 个 Vec3) + optional + variant
+    static_assert(dm::pack::max_size_v<BoundedOrder> ==
+        4 + 4 + (4 + 16) + (4 + 4 * sizeof(Vec3)) + (1 + 8) + (4 + 8));
+    // 声明上限不改变线上格式
+    static_assert(dm::pack::get_type_code<BoundedOrder>() == dm::pack::get_type_code<UnboundedOrder>());
+
+    BoundedOrder order{ 7, std::string("ESZ6"), std::vector<Vec3>{ { 1, 2, 3 }, { 4, 5, 6 } }, 100, 12.5 };
+    std::array<char, dm::pack::max_size_v<BoundedOrder>> slot;
+    std::size_t len = dm::pack::serialize_to(slot, order);
+    EXPECT_EQ(len, dm::pack::get_needed_size(order));
+
+    auto [err, out] = dm::pack::deserialize<UnboundedOrder>(slot.data(), len);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(out.symbol, "ESZ6");
+    ASSERT_EQ(out.legs.size(), 2u);
+    EXPECT_EQ(out.legs[1].y, 5);
+    EXPECT_EQ(std::get<double>(out.price), 12.5);
+
+    auto [err2, back] = dm::pack::deserialize<BoundedOrder>(slot.data(), len);
+    ASSERT_EQ(err2, std::errc{});
+    EXPECT_EQ(back.symbol, "ESZ6");
+    EXPECT_EQ(back.limit, 100);
+}
+
+TEST(DmPackBoundedTest, RejectsOverlongInput) {
+    UnboundedOrder order{ 1, std::string(17, 'x'), {}, std::nullopt, 0 };
+    auto buffer = dm::pack::serialize(order);
+    EXPECT_EQ(dm::pack::deserialize<BoundedOrder>(buffer).errc, std::errc::invalid_argument);
+    EXPECT_EQ(dm::pack::validate<BoundedOrder>(buffer), std::errc::invalid_argument);
+    EXPECT_EQ(dm::pack::validate<UnboundedOrder>(buffer), std::errc{});
+
+    order.symbol.resize(16);
+    buffer = dm::pack::serialize(order);
+    EXPECT_EQ(dm::pack::deserialize<BoundedOrder>(buffer).errc, std::errc{});
+}
+
+// --- Test Suite for channel ---
+TEST(DmPackChannelTest, WrapAroundAndDispatch) {
+    dm::pack::channel ch(100);
+    EXPECT_EQ(ch.capacity(), 128u);
+    EXPECT_TRUE(ch.empty());
+    int32_t value = 0;
+    EXPECT_EQ(ch.try_receive(value), std::errc::resource_unavailable_try_again);
+
+    // 每轮写入的位置都向后错开，反复经过环尾的回绕
+    for (int round = 0; round < 50; ++round) {
+        ASSERT_TRUE(ch.try_send(int32_t(round)));
+        ASSERT_TRUE(ch.try_send(std::string(round % 23, 'a')));
+        uint32_t code = 0;
+        ASSERT_TRUE(ch.peek_type_code(code));
+        EXPECT_EQ(code, dm::pack::get_type_code<int32_t>());
+
+        std::string text;
+        EXPECT_EQ(ch.try_receive(text), std::errc::invalid_argument);
+        ASSERT_EQ(ch.try_receive(value), std::errc{});
+        EXPECT_EQ(value, round);
+        std::size_t seen = 0;
+        auto code2 = ch.try_dispatch<int32_t, std::string>([&](const auto& v) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) { seen = v.size(); }
+        });
+        ASSERT_EQ(code2, std::errc{});
+        EXPECT_EQ(seen, std::size_t(round % 23));
+        EXPECT_TRUE(ch.empty());
+    }
+
+    // 放不下的消息被拒绝，通道满时返回 false
+    EXPECT_FALSE(ch.try_send(std::string(128, 'x')));
+    dm::pack::channel full(128);
+    int sent = 0;
+    while (full.try_send(int64_t(sent))) { ++sent; }
+    // 长度头 4 + 类型码 4 + int64 8
+    EXPECT_EQ(sent, 128 / 16);
+    EXPECT_TRUE(full.pop());
+    EXPECT_TRUE(full.try_send(int64_t(sent)));
+}
+
+TEST(DmPackChannelTest, ProducerConsumerThreads) {
+    constexpr int count = 20000;
+    dm::pack::channel ch(1024);
+    std::thread producer([&] {
+        for (int i = 0; i < count; ++i) {
+            PlainInner msg{ std::string(i % 37, char('a' + i % 26)), i, -i };
+            while (!ch.try_send(msg)) { std::this_thread::yield(); }
+        }
+    });
+    PlainInner out;
+    for (int i = 0; i < count; ++i) {
+        std::errc code;
+        while ((code = ch.try_receive(out)) == std::errc::resource_unavailable_try_again) { std::this_thread::yield(); }
+        ASSERT_EQ(code, std::errc{});
+        ASSERT_EQ(out.a, i);
+        ASSERT_EQ(out.b, -i);
+        ASSERT_EQ(out.name.size(), std::size_t(i % 37));
+    }
+    producer.join();
+    EXPECT_TRUE(ch.empty());
+}
+
+// --- Test Suite for pack_cursor ---
+template <typename... Args>
+static std::vector<char> drain_cursor(std::size_t budget, const Args&... args) {
+    dm::pack::pack_cursor cursor(args...);
+    std::vector<char> out;
+    std::vector<char> chunk(budget);
+    while (!cursor.done()) {
+        std::size_t n = cursor.step(chunk.data(), budget);
+        EXPECT_LE(n, budget);
+        out.insert(out.end(), chunk.begin(), chunk.begin() + n);
+    }
+    return out;
+}
+
+TEST(DmPackCursorTest, MatchesOneShot) {
+    Document doc;
+    doc.title = "cursor";
+    doc.subtitle = u"sub";
+    for (int i = 0; i < 200; ++i) {
+        doc.tags.push_back(std::string(i % 13, char('a' + i % 26)));
+        doc.points.push_back({ i, int16_t(-i) });
+        doc.index["k" + std::to_string(i % 17)].push_back(std::to_string(i));
+        doc.anchors.insert({ i % 31, int16_t(i % 7) });
+    }
+    doc.note = "end";
+    auto expected = dm::pack::serialize(doc);
+    for (std::size_t budget : { 1, 3, 64, 4096, 1 << 20 }) {
+        EXPECT_EQ(drain_cursor(budget, doc), expected) << budget;
+    }
+
+    Request req{ 9, true, Level::mid, { Level::low, Level::high }, std::string("payload"), { "a", "", "bc" } };
+    EXPECT_EQ(drain_cursor(5, req), dm::pack::serialize(req));
+
+    TimeSeries ts{ "t", { 1, 2, 3, 1000 }, { -1, 5, 7 } };
+    EXPECT_EQ(drain_cursor(2, ts), dm::pack::serialize(ts));
+    VisibilityFrame vf{ 3, { true, false, true }, std::bitset<100>(0x55) };
+    EXPECT_EQ(drain_cursor(7, vf), dm::pack::serialize(vf));
+
+    CompactMessage c{ 3, 77, 1700000000123ull, { 1.f, 2.f, 3.f }, { "in", -1, 2 }, { { "x", 1, 2 } }, "note", 0.25 };
+    EXPECT_EQ(drain_cursor(11, c), dm::pack::serialize(c));
+}
+
+TEST(DmPackCursorTest, SharedAndEmpty) {
+    Scene scene;
+    auto rock = std::make_shared<Mesh>(Mesh{ "rock", std::vector<float>(100, 1.f) });
+    scene.meshes = { rock, rock };
+    scene.instances.push_back({ rock, { 1, 2, 3 } });
+    scene.title = std::make_shared<const std::string>("t");
+    EXPECT_EQ(drain_cursor(13, scene), dm::pack::serialize(scene));
+
+    Scene empty;
+    EXPECT_EQ(drain_cursor(1, empty), dm::pack::serialize(empty));
+    std::vector<int32_t> none;
+    EXPECT_EQ(drain_cursor(1, none), dm::pack::serialize(none));
+
+    // 已完成的游标不再输出
+    int32_t five = 5;
+    dm::pack::pack_cursor cursor(five);
+    char buf[16];
+    EXPECT_EQ(cursor.step(buf, sizeof(buf)), 8u);
+    EXPECT_TRUE(cursor.done());
+    EXPECT_EQ(cursor.step(buf, sizeof(buf)), 0u);
+
+    // 多个参数与 serialize(args...) 相同
+    std::string text = "multi";
+    EXPECT_EQ(drain_cursor(3, five, text, scene), dm::pack::serialize(five, text, scene));
+}
+
+#if defined(__linux__)
+// --- Test Suite for snapshot ---
+static std::vector<char> read_file(const std::string& path) {
+    std::vector<char> out;
+    if (FILE* f = std::fopen(path.c_str(), "rb")) {
+        char buf[4096];
+        std::size_t n;
+        while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) { out.insert(out.end(), buf, buf + n); }
+        std::fclose(f);
+    }
+    return out;
+}
+
+TEST(DmPackSnapshotTest, WritesConsistentState) {
+    std::string path = "/tmp/dmpack_snapshot_" + std::to_string(::getpid()) + ".bin";
+    Document doc;
+    doc.title = "snapshot";
+    for (int i = 0; i < 50000; ++i) {
+        doc.tags.push_back(std::to_string(i));
+        doc.points.push_back({ i, int16_t(i) });
+    }
+    auto expected = dm::pack::serialize(doc);
+
+    dm::pack::snapshot snap;
+    ASSERT_EQ(snap.start(path, doc), std::errc{});
+    EXPECT_TRUE(snap.running());
+    EXPECT_EQ(snap.start(path, doc), std::errc::device_or_resource_busy);
+    // 父进程的修改不影响快照内容
+    doc.title = "changed";
+    doc.tags.clear();
+    EXPECT_EQ(snap.wait(), std::errc{});
+    EXPECT_FALSE(snap.running());
+    EXPECT_EQ(read_file(path), expected);
+
+    int32_t id = 7;
+    ASSERT_EQ(snap.start(path, id, doc), std::errc{});
+    std::errc code;
+    while ((code = snap.poll()) == std::errc::resource_unavailable_try_again) { std::this_thread::yield(); }
+    EXPECT_EQ(code, std::errc{});
+    EXPECT_EQ(read_file(path), dm::pack::serialize(id, doc));
+    std::remove(path.c_str());
+}
+
+TEST(DmPackSnapshotTest, ReportsChildErrors) {
+    dm::pack::snapshot snap;
+    int32_t value = 1;
+    ASSERT_EQ(snap.start("/nonexistent_dir_for_dmpack/x.bin", value), std::errc{});
+    EXPECT_EQ(snap.wait(), std::errc::no_such_file_or_directory);
+    EXPECT_EQ(snap.wait(), std::errc::no_such_file_or_directory);
+}
+#endif
+
+// --- Test Suite for packed_codec ---
+TEST(DmPackPackedTest, StripsPadding) {
+    static_assert(dm::pack::max_size_v<PackedSample> == 4 + 10);
+    static_assert(dm::pack::max_size_v<PaddedSample> == 4 + sizeof(PaddedSample));
+    static_assert(dm::pack::max_size_v<DensePacked> == 4 + sizeof(DensePacked));
+    static_assert(dm::pack::max_size_v<PackedHolder> == 4 + 2 + 2 * 10);
+    static_assert(dm::pack::get_type_code<PackedSample>() != dm::pack::get_type_code<PaddedSample>());
+    static_assert(dm::pack::get_type_code<std::vector<PackedSample>>() != dm::pack::get_type_code<std::vector<PaddedSample>>());
+
+    // 填充字节的内容不影响编码结果
+    PackedSample x, y;
+    std::memset(&x, 0xAA, sizeof(x));
+    std::memset(&y, 0x55, sizeof(y));
+    x.a = y.a = 1;
+    x.b = y.b = 0x0102030405060708ull;
+    x.c = y.c = 9;
+    auto buffer = dm::pack::serialize(x);
+    EXPECT_EQ(buffer.size(), 14u);
+    EXPECT_EQ(buffer, dm::pack::serialize(y));
+    auto [err, out] = dm::pack::deserialize<PackedSample>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(out.a, 1);
+    EXPECT_EQ(out.b, 0x0102030405060708ull);
+    EXPECT_EQ(out.c, 9);
+    EXPECT_EQ(dm::pack::deserialize<PaddedSample>(buffer).errc, std::errc::invalid_argument);
+
+    PackedRecord record{ "r", { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } }, PackedHolder{ 5, { { 1, 1, 1 }, { 2, 2, 2 } } } };
+    buffer = dm::pack::serialize(record);
+    EXPECT_EQ(buffer.size(), 4 + (4 + 1) + (4 + 3 * 10) + (1 + 2 + 2 * 10));
+    EXPECT_EQ(dm::pack::validate<PackedRecord>(buffer), std::errc{});
+    EXPECT_EQ(drain_cursor(3, record), buffer);
+    auto [err2, back] = dm::pack::deserialize<PackedRecord>(buffer);
+    ASSERT_EQ(err2, std::errc{});
+    ASSERT_EQ(back.samples.size(), 3u);
+    EXPECT_EQ(back.samples[2].b, 8u);
+    ASSERT_TRUE(back.holder.has_value());
+    EXPECT_EQ(back.holder->samples[1].c, 2);
+    EXPECT_EQ((dm::pack::get_field<PackedRecord, 1>(buffer).value[1].b), 5u);
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        EXPECT_NE(dm::pack::deserialize<PackedRecord>(buffer.data(), len).errc, std::errc{}) << len;
+    }
+}
+
+TEST(DmPackPackedTest, MigratesBetweenLayouts) {
+    PaddedSample padded{ 1, 2, 3 };
+    dm::pack::migrator<PackedSample> to_packed(dm::pack::get_type_literal<PaddedSample>());
+    ASSERT_EQ(to_packed.error(), std::errc{});
+    auto [err, packed] = to_packed.deserialize(dm::pack::serialize(padded));
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_EQ(packed.b, 2u);
+    EXPECT_EQ(packed.c, 3);
+
+    dm::pack::migrator<PaddedSample> to_padded(dm::pack::get_type_literal<PackedSample>());
+    ASSERT_EQ(to_padded.error(), std::errc{});
+    auto [err2, back] = to_padded.deserialize(dm::pack::serialize(packed));
+    ASSERT_EQ(err2, std::errc{});
+    EXPECT_EQ(back.a, 1);
+    EXPECT_EQ(back.b, 2u);
+
+    std::vector<PaddedSample> list{ { 1, 2, 3 }, { 4, 5, 6 } };
+    dm::pack::migrator<std::vector<PackedSample>> list_migrator(dm::pack::get_type_literal<std::vector<PaddedSample>>());
+    auto [err3, list_out] = list_migrator.deserialize(dm::pack::serialize(list));
+    ASSERT_EQ(err3, std::errc{});
+    ASSERT_EQ(list_out.size(), 2u);
+    EXPECT_EQ(list_out[1].c, 6);
+}
+
+// --- Test Suite for string_table / jagged ---
+struct InvertedIndex {
+    dm::pack::string_table terms;
+    dm::pack::jagged<uint32_t> postings;
+};
+
+struct NestedIndex {
+    std::vector<std::string> terms;
+    std::vector<std::vector<uint32_t>> postings;
+};
+
+TEST(DmPackFlatTest, SameWireAsNestedVectors) {
+    static_assert(dm::pack::get_type_code<dm::pack::string_table>() == dm::pack::get_type_code<std::vector<std::string>>());
+    static_assert(dm::pack::get_type_code<dm::pack::jagged<int32_t>>() == dm::pack::get_type_code<std::vector<std::vector<int32_t>>>());
+    static_assert(dm::pack::get_type_code<InvertedIndex>() == dm::pack::get_type_code<NestedIndex>());
+
+    NestedIndex nested{ { "alpha", "", "gamma-delta" }, { { 1, 5, 9 }, {}, { 42 } } };
+    auto buffer = dm::pack::serialize(nested);
+    auto [err, flat] = dm::pack::deserialize<InvertedIndex>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    ASSERT_EQ(flat.terms.size(), 3u);
+    EXPECT_EQ(flat.terms[0], "alpha");
+    EXPECT_EQ(flat.terms[1], "");
+    EXPECT_EQ(flat.terms[2], "gamma-delta");
+    EXPECT_EQ(flat.terms.values().size(), 16u);
+    ASSERT_EQ(flat.postings.size(), 3u);
+    EXPECT_TRUE(flat.postings[1].empty());
+    EXPECT_EQ(flat.postings[0][2], 9u);
+    EXPECT_EQ(flat.postings[2][0], 42u);
+    EXPECT_EQ((std::vector<std::size_t>{ 0, 3, 3, 4 }), flat.postings.offsets());
+
+    // 反向: 扁平结构写出的数据按嵌套容器解码，编码结果逐字节相同
+    EXPECT_EQ(dm::pack::serialize(flat), buffer);
+    EXPECT_EQ(dm::pack::get_needed_size(flat), buffer.size());
+    EXPECT_EQ(drain_cursor(5, flat), buffer);
+    auto [err2, back] = dm::pack::deserialize<NestedIndex>(dm::pack::serialize(flat));
+    ASSERT_EQ(err2, std::errc{});
+    EXPECT_EQ(back.terms, nested.terms);
+    EXPECT_EQ(back.postings, nested.postings);
+
+    // 解码到已有对象时替换原有内容
+    InvertedIndex reused{ { "x", "y" }, { { 7 } } };
+    ASSERT_EQ(dm::pack::deserialize_to(reused, buffer), std::errc{});
+    EXPECT_TRUE(reused.terms == flat.terms);
+    EXPECT_TRUE(reused.postings == flat.postings);
+    std::vector<std::string_view> views(reused.terms.begin(), reused.terms.end());
+    EXPECT_EQ(views.back(), "gamma-delta");
+}
+
+TEST(DmPackFlatTest, RejectsMalformedInput) {
+    dm::pack::string_table tags{ "a", "bb", "ccc" };
+    auto buffer = dm::pack::serialize(tags);
+    EXPECT_EQ(dm::pack::validate<dm::pack::string_table>(buffer), std::errc{});
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        EXPECT_NE(dm::pack::deserialize<dm::pack::string_table>(buffer.data(), len).errc, std::errc{}) << len;
+        EXPECT_NE(dm::pack::validate<dm::pack::string_table>(buffer.data(), len), std::errc{}) << len;
+    }
+
+    // 伪造的行数与行长度
+    auto forged = buffer;
+    uint32_t huge = 0x7fffffff;
+    std::memcpy(forged.data() + 4, &huge, sizeof(huge));
+    EXPECT_EQ(dm::pack::deserialize<dm::pack::string_table>(forged).errc, std::errc::no_buffer_space);
+    forged = buffer;
+    std::memcpy(forged.data() + 8, &huge, sizeof(huge));
+    EXPECT_EQ(dm::pack::deserialize<dm::pack::string_table>(forged).errc, std::errc::no_buffer_space);
+
+    dm::pack::jagged<uint64_t> rows{ { 1, 2 }, { 3 } };
+    buffer = dm::pack::serialize(rows);
+    EXPECT_EQ(dm::pack::deserialize<dm::pack::jagged<uint64_t>>(buffer, dm::pack::memory_budget{ 16 }).errc, std::errc::not_enough_memory);
+    auto [err, out] = dm::pack::deserialize<dm::pack::jagged<uint64_t>>(buffer, dm::pack::memory_budget{ 1024 });
+    ASSERT_EQ(err, std::errc{});
+    EXPECT_TRUE(out == rows);
+}
+
+// --- Test Suite for dm::split ---
+struct Actor {
+    std::string name;
+    float x;
+    float y;
+    std::vector<int> inventory;
+    std::shared_ptr<std::string> team;
+};
+
+struct Waypoint {
+    int32_t id;
+    double x;
+    char tag;
+};
+
+TEST(DmPackSplitTest, SameWireAsVector) {
+    using actors_t = dm::split<Actor, 1, 2>;
+    static_assert(dm::pack::get_type_code<actors_t>() == dm::pack::get_type_code<std::vector<Actor>>());
+
+    auto red = std::make_shared<std::string>("red");
+    std::vector<Actor> actors{ { "a", 1, 2, { 1, 2, 3 }, red }, { "", -1, 0, {}, nullptr }, { "ccc", 5, 6, { 7 }, red } };
+    auto buffer = dm::pack::serialize(actors);
+    auto [err, split] = dm::pack::deserialize<actors_t>(buffer);
+    ASSERT_EQ(err, std::errc{});
+    ASSERT_EQ(split.size(), 3u);
+    EXPECT_EQ(split.get<0>(2), "ccc");
+    EXPECT_EQ(split.get<1>(1), -1.0f);
+    EXPECT_EQ(split.get<3>(0), (std::vector<int>{ 1, 2, 3 }));
+    EXPECT_EQ(split.get<4>(1), nullptr);
+    ASSERT_NE(split.get<4>(0), nullptr);
+    EXPECT_EQ(split.get<4>(0), split.get<4>(2));
+
+    // 反向: split 写出的数据按 vector 解码，编码结果逐字节相同
+    EXPECT_EQ(dm::pack::serialize(split), buffer);
+    EXPECT_EQ(dm::pack::get_needed_size(split), buffer.size());
+    EXPECT_EQ(drain_cursor(3, split), buffer);
+    EXPECT_EQ(dm::pack::validate<actors_t>(buffer), std::errc{});
+    auto [err2, back] = dm::pack::deserialize<std::vector<Actor>>(dm::pack::serialize(split));
+    ASSERT_EQ(err2, std::errc{});
+    ASSERT_EQ(back.size(), actors.size());
+    for (size_t i = 0; i < actors.size(); ++i) {
+        EXPECT_EQ(back[i].name, actors[i].name);
+        EXPECT_EQ(back[i].y, actors[i].y);
+        EXPECT_EQ(back[i].inventory, actors[i].inventory);
+    }
+    EXPECT_EQ(back[0].team, back[2].team);
+
+    // 解码到已有对象时替换原有内容
+    actors_t reused;
+    reused.push_back({ "x", 0, 0, { 9 }, nullptr });
+    ASSERT_EQ(dm::pack::deserialize_to(reused, buffer), std::errc{});
+    ASSERT_EQ(reused.size(), 3u);
+    EXPECT_EQ(reused.get<0>(0), "a");
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        EXPECT_NE(dm::pack::deserialize<actors_t>(buffer.data(), len).errc, std::errc{}) << len;
+    }
+
+    // 整块拷贝的 T 按整行写出 (填充字节的内容不确定，只比较解码结果)
+    std::vector<Waypoint> points{ { 1, 0.5, 'a' }, { 2, 1.5, 'b' } };
+    dm::split<Waypoint, 1> split_points(points);
+    auto packed = dm::pack::serialize(split_points);
+    EXPECT_EQ(packed.size(), dm::pack::serialize(points).size());
+    EXPECT_EQ(drain_cursor(5, split_points).size(), packed.size());
+    auto [err3, points_back] = dm::pack::deserialize<std::vector<Waypoint>>(packed);
+    ASSERT_EQ(err3, std::errc{});
+    ASSERT_EQ(points_back.size(), 2u);
+    EXPECT_EQ(points_back[1].x, 1.5);
+    EXPECT_EQ(points_back[1].tag, 'b');
+    auto [err4, split_back] = dm::pack::deserialize<dm::split<Waypoint, 1>>(dm::pack::serialize(points));
+    ASSERT_EQ(err4, std::errc{});
+    EXPECT_EQ(split_back.get<0>(1), 2);
+    EXPECT_EQ(split_back.get<2>(0), 'a');
+}
@@ -7,6 +7,11 @@
 #include <set>
 #include <memory>
 #include <functional>
+#include <bitset>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <stdexcept>
 #include "dmformat.h"
 // --- 测试用的辅助类型和函数 ---
 struct MyClass {
@@ -181,4 +186,381 @@ TEST(DmTypeListTest, TypeListOperations) {
     fmt::print("{}\n", dm_type_name<PoppedFront>());
     fmt::print("{}\n", dm_type_name<Pointers>());
     fmt::print("{}\n", dm_type_name<Integrals>());
-}
\ No newline at end of file
+}
+
+// --- Test Suite for dmtypetraits_reflection.h ---
+struct WideStruct {
+    int f0; int f1; int f2; int f3; int f4; int f5; int f6; int f7; int f8; int f9;
+    int f10; int f11; int f12; int f13; int f14; int f15; int f16; int f17; int f18; int f19;
+    int f20; int f21; int f22; int f23; int f24; int f25; int f26; int f27; int f28; int f29;
+    int f30; int f31; int f32; int f33; int f34; int f35; int f36; int f37; int f38; int f39;
+    int f40; int f41; int f42; int f43; int f44; int f45; int f46; int f47; int f48; int f49;
+    int f50; int f51; int f52; int f53; int f54; int f55; int f56; int f57; int f58; int f59;
+    int f60; int f61; int f62; int f63; int f64; int f65; int f66; int f67; int f68; int f69;
+    int f70; int f71; int f72; int f73; int f74; int f75; int f76; int f77; int f78; int f79;
+    int f80; int f81; int f82; int f83; int f84; int f85; int f86; int f87; int f88; int f89;
+    int f90; int f91; int f92; int f93; int f94; int f95; int f96; int f97; int f98; int f99;
+    int f100; int f101; int f102; int f103; int f104; int f105; int f106; int f107; int f108; int f109;
+    int f110; int f111; int f112; int f113; int f114; int f115; int f116; int f117; int f118; int f119;
+    int f120; int f121; int f122; int f123; int f124; int f125; int f126; int f127; int f128; int f129;
+    int f130; int f131; int f132; int f133; int f134; int f135; int f136; int f137; int f138; int f139;
+    int f140; int f141; int f142; int f143; int f144; int f145; int f146; int f147; int f148; int f149;
+    int f150; int f151; int f152; int f153; int f154; int f155; int f156; int f157; int f158; int f159;
+    int f160; int f161; int f162; int f163; int f164; int f165; int f166; int f167; int f168; int f169;
+    int f170; int f171; int f172; int f173; int f174; int f175; int f176; int f177; int f178; int f179;
+    int f180; int f181; int f182; int f183; int f184; int f185; int f186; int f187; int f188; int f189;
+    int f190; int f191; int f192; int f193; int f194; int f195; int f196; int f197; int f198; int f199;
+};
+
+struct MixedStruct {
+    int id;
+    std::bitset<8> flags;
+    std::string name;
+    std::vector<int> values;
+    std::bitset<100> mask;
+    double ratio;
+};
+
+TEST(DmReflectionTest, MemberCountAndVisit) {
+    static_assert(dm_member_count_v<WideStruct> == 200, "Test Failed: 200 members");
+    static_assert(dm_member_count_v<MixedStruct> == 6, "Test Failed: bitset members");
+
+    WideStruct wide{};
+    wide.f0 = 1;
+    wide.f199 = 200;
+    int count = 0;
+    int sum = 0;
+    dm_visit_members(wide, [&](auto&&... members) {
+        count = static_cast<int>(sizeof...(members));
+        sum = (members + ...);
+    });
+    EXPECT_EQ(count, 200);
+    EXPECT_EQ(sum, 201);
+
+    MixedStruct mixed{ 7, 0x5, "mixed", { 1, 2 }, {}, 0.5 };
+    dm_visit_members(mixed, [&](auto& id, auto& flags, auto& name, auto&, auto&, auto& ratio) {
+        EXPECT_EQ(id, 7);
+        EXPECT_EQ(flags.count(), 2u);
+        EXPECT_EQ(name, "mixed");
+        EXPECT_EQ(ratio, 0.5);
+    });
+}
+
+struct Particle {
+    float x;
+    float y;
+    bool alive;
+    std::string tag;
+};
+
+TEST(DmSoaVectorTest, ColumnsAndRoundTrip) {
+    std::vector<Particle> particles{ { 1.0f, 2.0f, true, "a" }, { 3.0f, 4.0f, false, "b" }, { 5.0f, 6.0f, true, "c" } };
+    dm::soa_vector<Particle> soa(particles);
+    static_assert(dm::soa_vector<Particle>::column_count == 4);
+    ASSERT_EQ(soa.size(), 3u);
+
+    // 单列是连续数组
+    float sum = 0;
+    for (float x : soa.column<0>()) { sum += x; }
+    EXPECT_EQ(sum, 9.0f);
+    EXPECT_EQ(soa.column<2>().data()[1], false);
+
+    soa[1].get<3>() = "bb";
+    soa[2] = Particle{ 7.0f, 8.0f, false, "cc" };
+    Particle second = soa[1];
+    EXPECT_EQ(second.tag, "bb");
+    EXPECT_EQ(soa.column<0>()[2], 7.0f);
+
+    for (int i = 0; i < 100; ++i) { soa.push_back(Particle{ float(i), 0.0f, true, std::to_string(i) }); }
+    ASSERT_EQ(soa.size(), 103u);
+    soa.erase(0);
+    EXPECT_EQ(soa[0].get<3>(), "bb");
+    EXPECT_EQ(soa[102 - 1].get<3>(), "99");
+    soa.pop_back();
+
+    dm::soa_vector<Particle> copy = soa;
+    std::vector<Particle> back = copy.to_vector();
+    ASSERT_EQ(back.size(), 101u);
+    EXPECT_EQ(back[1].tag, "cc");
+    EXPECT_EQ(back[100].tag, "98");
+
+    size_t alive = 0;
+    for (auto p : static_cast<const dm::soa_vector<Particle>&>(copy)) { alive += p.get<2>() ? 1 : 0; }
+    EXPECT_EQ(alive, 99u);
+
+    dm::soa_vector<Particle> moved = std::move(copy);
+    EXPECT_EQ(moved.size(), 101u);
+    EXPECT_TRUE(copy.empty());
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+}
+
+// 复制 fuse 次之后抛出的成员类型，live 记录存活的对象数
+struct CopyBomb {
+    static inline int live = 0;
+    static inline int fuse = -1;
+    int value = 0;
+    CopyBomb() { ++live; }
+    CopyBomb(const CopyBomb& other) : value(other.value) {
+        if (fuse == 0) { throw std::runtime_error("copy"); }
+        if (fuse > 0) { --fuse; }
+        ++live;
+    }
+    CopyBomb& operator=(const CopyBomb&) = default;
+    ~CopyBomb() { --live; }
+};
+
+struct Loaded {
+    std::string name;
+    CopyBomb bomb;
+};
+
+TEST(DmSoaVectorTest, ExceptionRollback) {
+    const std::string name(32, 'x');
+    {
+        dm::soa_vector<Loaded> soa;
+        soa.reserve(2);
+        Loaded row{ name, CopyBomb() };
+        soa.push_back(row);
+
+        // 第二列构造失败: 第一列已构造的字符串被销毁，size 不变
+        CopyBomb::fuse = 0;
+        EXPECT_THROW(soa.push_back(row), std::runtime_error);
+        EXPECT_EQ(soa.size(), 1u);
+
+        // 扩容时搬迁第二个元素失败: 原有元素与容量保持不变
+        CopyBomb::fuse = -1;
+        soa.push_back(row);
+        CopyBomb::fuse = 1;
+        EXPECT_THROW(soa.push_back(row), std::runtime_error);
+        EXPECT_EQ(soa.size(), 2u);
+        EXPECT_EQ(soa.capacity(), 2u);
+        EXPECT_EQ(soa[0].get<0>(), name);
+        EXPECT_EQ(soa[1].get<0>(), name);
+
+        CopyBomb::fuse = 1;
+        EXPECT_THROW(dm::soa_vector<Loaded> copy(soa), std::runtime_error);
+        CopyBomb::fuse = 0;
+        EXPECT_THROW(dm::soa_vector<Loaded> from(std::vector<Loaded>(1)), std::runtime_error);
+
+        CopyBomb::fuse = -1;
+        dm::soa_vector<Loaded> copy(soa);
+        EXPECT_EQ(copy.size(), 2u);
+        EXPECT_EQ(copy[1].get<0>(), name);
+    }
+    EXPECT_EQ(CopyBomb::live, 0);
+}
+
+struct GridKey {
+    int32_t x;
+    int32_t y;
+    bool operator==(const GridKey& other) const { return dm::equal(*this, other); }
+};
+
+struct RouteKey {
+    std::string name;
+    double weight;
+    std::vector<GridKey> path;
+    std::optional<int> limit;
+    std::set<std::string> tags;
+    bool operator==(const RouteKey& other) const { return dm::equal(*this, other); }
+};
+
+TEST(DmHashTest, AggregateHash) {
+    static_assert(std::has_unique_object_representations_v<GridKey>);
+    dm::hash<GridKey> grid_hash;
+    EXPECT_EQ(grid_hash({ 1, 2 }), grid_hash({ 1, 2 }));
+    EXPECT_NE(grid_hash({ 1, 2 }), grid_hash({ 2, 1 }));
+
+    RouteKey a{ "north", 0.0, { { 1, 2 }, { 3, 4 } }, 5, { "x", "y" } };
+    RouteKey b = a;
+    b.weight = -0.0;                                       // -0.0 == 0.0
+    dm::hash<RouteKey> route_hash;
+    EXPECT_EQ(route_hash(a), route_hash(b));
+    b.limit.reset();
+    EXPECT_NE(route_hash(a), route_hash(b));
+
+    // 不同长度与内容的字符串
+    std::set<size_t> seen;
+    for (int i = 0; i < 1000; ++i) { seen.insert(dm::hash<std::string>{}(std::string(i % 97, 'a') + std::to_string(i))); }
+    EXPECT_EQ(seen.size(), 1000u);
+
+    std::unordered_map<RouteKey, int, dm::hash<RouteKey>> routes;
+    routes[a] = 1;
+    routes[b] = 2;
+    EXPECT_EQ(routes.size(), 2u);
+    EXPECT_EQ(routes[a], 1);
+
+    std::unordered_set<int> s1{ 1, 2, 3, 4, 5, 6, 7, 8 };
+    std::unordered_set<int> s2;
+    for (int i = 8; i >= 1; --i) { s2.insert(i); }
+    EXPECT_EQ(dm::hash<std::unordered_set<int>>{}(s1), dm::hash<std::unordered_set<int>>{}(s2));
+}
+
+struct Version {
+    uint16_t major;
+    uint16_t minor;
+    std::vector<unsigned char> build;
+    std::variant<int, std::string> channel;
+};
+
+TEST(DmCompareTest, EqualAndCompare) {
+    std::vector<GridKey> grid_a{ { 1, 2 }, { 3, 4 } };
+    std::vector<GridKey> grid_b = grid_a;
+    EXPECT_TRUE(dm::equal(grid_a, grid_b));
+    grid_b[1].y = 5;
+    EXPECT_FALSE(dm::equal(grid_a, grid_b));
+    EXPECT_EQ(dm::compare(grid_a, grid_b), -1);
+    EXPECT_EQ(dm::compare(GridKey{ 256, 0 }, GridKey{ 1, 0 }), 1);   // 按数值而不是内存字节比较
+
+    RouteKey a{ "north", 0.5, { { 1, 2 } }, std::nullopt, { "x" } };
+    RouteKey b = a;
+    EXPECT_TRUE(a == b);
+    b.tags.insert("y");
+    EXPECT_FALSE(a == b);
+
+    Version v1{ 1, 2, { 1, 2, 3 }, 7 };
+    Version v2{ 1, 2, { 1, 2, 3 }, 7 };
+    EXPECT_TRUE(dm::equal(v1, v2));
+    EXPECT_EQ(dm::compare(v1, v2), 0);
+    v2.build.push_back(0);
+    EXPECT_EQ(dm::compare(v1, v2), -1);
+    v2.build = { 1, 2 };
+    EXPECT_EQ(dm::compare(v1, v2), 1);
+    v2 = v1;
+    v2.channel = std::string("beta");
+    EXPECT_FALSE(dm::equal(v1, v2));
+    EXPECT_EQ(dm::compare(v1, v2), -1);
+    v2 = v1;
+    v2.minor = 1;
+    EXPECT_EQ(dm::compare(v1, v2), 1);
+
+    // 定长字符数组按全部字节比较: 内嵌 NUL 之后的内容与没有结尾 NUL 的满缓冲区都参与比较
+    struct Label { char text[4]; };
+    Label l1{ { 'a', '\0', 'x', 'y' } };
+    Label l2{ { 'a', '\0', 'x', 'z' } };
+    EXPECT_FALSE(dm::equal(l1, l2));
+    EXPECT_EQ(dm::compare(l1, l2), -1);
+    EXPECT_EQ(dm::compare(l2, l1), 1);
+    Label full1{ { 'a', 'b', 'c', 'd' } };
+    Label full2{ { 'a', 'b', 'c', 'd' } };
+    EXPECT_TRUE(dm::equal(full1, full2));
+    EXPECT_EQ(dm::compare(full1, full2), 0);
+    full2.text[3] = 'e';
+    EXPECT_EQ(dm::compare(full1, full2), -1);
+}
+
+struct LooseLayout {
+    char flag;
+    double value;
+    char kind;
+    int32_t count;
+    std::array<uint16_t, 3> ids;
+};
+
+TEST(DmLayoutTest, OffsetsAndPadding) {
+    static_assert(dm::member_offsets_v<LooseLayout>[0] == offsetof(LooseLayout, flag));
+    static_assert(dm::member_offsets_v<LooseLayout>[1] == offsetof(LooseLayout, value));
+    static_assert(dm::member_offsets_v<LooseLayout>[2] == offsetof(LooseLayout, kind));
+    static_assert(dm::member_offsets_v<LooseLayout>[3] == offsetof(LooseLayout, count));
+    static_assert(dm::member_offsets_v<LooseLayout>[4] == offsetof(LooseLayout, ids));
+    static_assert(dm::member_sizes_v<LooseLayout>[4] == sizeof(std::array<uint16_t, 3>));
+
+    constexpr auto report = dm::padding_report_v<LooseLayout>;
+    static_assert(report.size == sizeof(LooseLayout));
+    static_assert(report.padding == sizeof(LooseLayout) - (1 + 8 + 1 + 4 + 6));
+    static_assert(report.suggested_order[0] == 1 && report.suggested_order[1] == 3);
+    static_assert(report.reordered_size == 24);
+    EXPECT_EQ(report.saving(), sizeof(LooseLayout) - 24);
+
+    // 非标准布局的聚合体同样适用
+    static_assert(dm::member_offsets_v<RouteKey>[1] == sizeof(std::string));
+    constexpr auto grid = dm::padding_report_v<GridKey>;
+    static_assert(grid.padding == 0 && grid.saving() == 0);
+}
+
+struct Entity {
+    std::string name;
+    float x;
+    float y;
+    std::vector<int> inventory;
+    float vx;
+    float vy;
+};
+
+TEST(DmSplitTest, HotColdSplit) {
+    using entities_t = dm::split<Entity, 1, 2, 4, 5>;
+    static_assert(std::is_same_v<entities_t::hot_row, std::tuple<float, float, float, float>>);
+    static_assert(std::is_same_v<entities_t::cold_row, std::tuple<std::string, std::vector<int>>>);
+    static_assert(entities_t::is_hot_v<1> && !entities_t::is_hot_v<3>);
+
+    entities_t entities(std::vector<Entity>{ { "a", 0, 0, { 1 }, 1, 2 }, { "b", 10, 10, {}, -1, 0 } });
+    entities.push_back({ "c", 5, 5, { 2, 3 }, 0, 1 });
+    ASSERT_EQ(entities.size(), 3u);
+
+    // 每帧只更新热成员
+    entities.for_each_hot([](float& x, float& y, float vx, float vy) { x += vx; y += vy; });
+    EXPECT_EQ(entities.get<1>(0), 1.0f);
+    EXPECT_EQ(entities.get<2>(2), 6.0f);
+    EXPECT_EQ(entities[1].get<0>(), "b");
+
+    std::string names;
+    size_t items = 0;
+    entities.visit(2, [&](const std::string& name, float, float, const std::vector<int>& inventory, float, float) {
+        names += name;
+        items += inventory.size();
+    });
+    EXPECT_EQ(names, "c");
+    EXPECT_EQ(items, 2u);
+
+    entities[0] = Entity{ "z", 1, 1, { 7, 8, 9 }, 0, 0 };
+    Entity first = entities[0];
+    EXPECT_EQ(first.inventory.size(), 3u);
+    entities.erase(1);
+
+    std::vector<Entity> back = entities.to_vector();
+    ASSERT_EQ(back.size(), 2u);
+    EXPECT_EQ(back[0].name, "z");
+    EXPECT_EQ(back[1].name, "c");
+    EXPECT_EQ(back[1].y, 6.0f);
+
+    // 右值插入移动成员而不是复制
+    Entity moving{ "m", 0, 0, { 4, 5 }, 0, 0 };
+    entities.push_back(std::move(moving));
+    EXPECT_TRUE(moving.inventory.empty());
+    EXPECT_EQ(entities.get<3>(2).size(), 2u);
+
+    // 冷行构造失败时撤销热行
+    {
+        dm::split<Loaded, 0> loaded;
+        Loaded row{ "hot", CopyBomb() };
+        loaded.push_back(row);
+        CopyBomb::fuse = 0;
+        EXPECT_THROW(loaded.push_back(row), std::runtime_error);
+        CopyBomb::fuse = -1;
+        EXPECT_EQ(loaded.size(), 1u);
+        EXPECT_EQ(loaded.hot_rows().size(), loaded.cold_rows().size());
+    }
+    EXPECT_EQ(CopyBomb::live, 0);
+}
+
+#if DMPACK_HAS_MEMBER_NAMES
+struct NamedStruct {
+    int id;
+    std::string display_name;
+    std::bitset<8> flags;
+    std::unique_ptr<int> owner;
+    double scores[4];
+};
+
+TEST(DmReflectionTest, MemberNames) {
+    static_assert(dm_member_names_v<NamedStruct>.size() == 5);
+    static_assert(dm_member_name_v<NamedStruct, 0> == "id");
+    static_assert(dm_member_name_v<NamedStruct, 1> == "display_name");
+    static_assert(dm_member_name_v<NamedStruct, 4> == "scores");
+    static_assert(dm_member_index<NamedStruct>("owner") == 3);
+    static_assert(dm_member_index<NamedStruct>("missing") == 5);
+    static_assert(dm_member_name_v<WideStruct, 199> == "f199");
+    EXPECT_EQ(dm_member_names_v<MixedStruct>[2], "name");
+}
+#endif